@@ -0,0 +1,3 @@
+#pragma once
+
+// included by the Adafruit GFX Library headers, only its displays use it
@@ -0,0 +1,63 @@
+#pragma once
+
+// Stand-in for the parts of the ESP32 Arduino core that the screens, and the
+// libraries they draw with, use. Just enough to draw frames on the host, see
+// [env:native] in platformio.ini and native/src.
+
+#include <assert.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <algorithm>
+
+#include <FreeRTOS.h>
+#include <esp_sleep.h>
+
+#include "Print.h"
+
+#define PROGMEM
+#define RTC_DATA_ATTR  // nothing sleeps natively, it's all just memory
+#define IRAM_ATTR
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+using std::max;
+using std::min;
+
+unsigned long millis();
+unsigned long micros();
+void delay(uint32_t ms);
+
+// the ESP32 logging macros, on stderr so that stdout only has what the
+// program prints
+#ifndef CORE_DEBUG_LEVEL
+#define CORE_DEBUG_LEVEL 0
+#endif
+#define WATCHY_NATIVE_LOG(level, letter, format, ...)                      \
+  do {                                                                     \
+    if (CORE_DEBUG_LEVEL >= level) {                                       \
+      fprintf(stderr, "[" letter "][%s:%u] %s(): " format "\n", __FILE__, \
+              __LINE__, __func__, ##__VA_ARGS__);                          \
+    }                                                                      \
+  } while (0)
+#define log_e(format, ...) WATCHY_NATIVE_LOG(1, "E", format, ##__VA_ARGS__)
+#define log_w(format, ...) WATCHY_NATIVE_LOG(2, "W", format, ##__VA_ARGS__)
+#define log_i(format, ...) WATCHY_NATIVE_LOG(3, "I", format, ##__VA_ARGS__)
+#define log_d(format, ...) WATCHY_NATIVE_LOG(4, "D", format, ##__VA_ARGS__)
+#define log_v(format, ...) WATCHY_NATIVE_LOG(5, "V", format, ##__VA_ARGS__)
+
+// writes to stdout
+class HardwareSerial : public Print {
+ public:
+  void begin(unsigned long baud) {}
+  using Print::write;
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t *buffer, size_t size) override;
+};
+
+extern HardwareSerial Serial;
@@ -0,0 +1,3 @@
+#pragma once
+
+// included by BLE.h, nothing in it is used natively
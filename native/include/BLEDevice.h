@@ -0,0 +1,6 @@
+#pragma once
+
+// included by BLE.h, which only keeps pointers to these
+class BLECharacteristic;
+class BLEServer;
+class BLEService;
@@ -0,0 +1,7 @@
+#pragma once
+
+#include <Arduino.h>
+#include <TimeLib.h>
+
+// WatchyRTC keeps one of these, the native WatchyRTC doesn't use it
+class DS3232RTC {};
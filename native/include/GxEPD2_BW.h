@@ -0,0 +1,37 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "GxEPD2.h"
+
+// Stand-in for the Watchy's panel. WatchyDisplay draws into its own frame
+// buffer, and natively there is no refresh task to send frames to the panel,
+// so it doesn't do anything.
+class GxEPD2_154_D67 {
+ public:
+  static const uint16_t WIDTH = 200;
+  static const uint16_t HEIGHT = 200;
+
+  GxEPD2_154_D67(int16_t cs, int16_t dc, int16_t rst, int16_t busy) {}
+  void init(uint32_t serial_diag_bitrate, bool initial,
+            uint16_t reset_duration = 10, bool pulldown_rst_mode = false) {}
+  void writeImage(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w,
+                  int16_t h, bool invert = false, bool mirror_y = false,
+                  bool pgm = false) {}
+  void writeImageAgain(const uint8_t bitmap[], int16_t x, int16_t y,
+                       int16_t w, int16_t h, bool invert = false,
+                       bool mirror_y = false, bool pgm = false) {}
+  void writeImagePart(const uint8_t bitmap[], int16_t x_part, int16_t y_part,
+                      int16_t w_bitmap, int16_t h_bitmap, int16_t x, int16_t y,
+                      int16_t w, int16_t h, bool invert = false,
+                      bool mirror_y = false, bool pgm = false) {}
+  void writeImagePartAgain(const uint8_t bitmap[], int16_t x_part,
+                           int16_t y_part, int16_t w_bitmap, int16_t h_bitmap,
+                           int16_t x, int16_t y, int16_t w, int16_t h,
+                           bool invert = false, bool mirror_y = false,
+                           bool pgm = false) {}
+  void refresh(bool partial_update_mode = false) {}
+  void refresh(int16_t x, int16_t y, int16_t w, int16_t h) {}
+  void powerOff() {}
+  void hibernate() {}
+};
@@ -0,0 +1,3 @@
+#pragma once
+
+// included by the watch's headers, nothing in it is used natively
@@ -0,0 +1,4 @@
+#pragma once
+
+// WatchyRTC keeps one of these, the native WatchyRTC doesn't use it
+class Rtc_Pcf8563 {};
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <string>
+
+// Stand-in for the Arduino String, only enough of it to pass strings around
+class __FlashStringHelper;
+#define F(s) (reinterpret_cast<const __FlashStringHelper *>(s))
+
+class String {
+  std::string _s;
+
+ public:
+  String(const char *s = "") : _s(s == nullptr ? "" : s) {}
+  const char *c_str() const { return _s.c_str(); }
+  unsigned int length() const { return _s.length(); }
+  bool operator==(const String &s) const { return _s == s._s; }
+  bool operator!=(const String &s) const { return _s != s._s; }
+};
@@ -0,0 +1,28 @@
+#include <Arduino.h>
+
+#include <time.h>
+
+HardwareSerial Serial;
+
+static uint64_t monotonicMicros() {
+  timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return uint64_t(ts.tv_sec) * 1000000 + ts.tv_nsec / 1000;
+}
+
+static const uint64_t startMicros = monotonicMicros();
+
+unsigned long millis() { return (monotonicMicros() - startMicros) / 1000; }
+
+unsigned long micros() { return monotonicMicros() - startMicros; }
+
+void delay(uint32_t ms) {
+  const timespec ts = {time_t(ms / 1000), long(ms % 1000) * 1000000};
+  nanosleep(&ts, nullptr);
+}
+
+size_t HardwareSerial::write(uint8_t c) { return fputc(c, stdout) == EOF ? 0 : 1; }
+
+size_t HardwareSerial::write(const uint8_t *buffer, size_t size) {
+  return fwrite(buffer, 1, size, stdout);
+}
@@ -0,0 +1,24 @@
+#include "Events.h"
+
+// There's no event queue natively, only the list of background tasks, which
+// nothing waits on
+
+namespace Watchy_Event {
+
+std::vector<const BackgroundTask *> BackgroundTask::tasks;
+
+void BackgroundTask::add() const { tasks.push_back(this); }
+
+void BackgroundTask::remove() const {
+  for (auto it = tasks.begin(); it != tasks.end(); it++) {
+    if (*it == this) {
+      tasks.erase(it);
+      break;
+    }
+  }
+}
+
+bool BackgroundTask::running() { return !tasks.empty(); }
+
+BackgroundTask::~BackgroundTask() {}
+}  // namespace Watchy_Event
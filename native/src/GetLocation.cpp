@@ -0,0 +1,16 @@
+#include "GetLocation.h"
+
+#include "config.h"
+
+// nothing is looked up natively, it's always the default location
+
+namespace Watchy_GetLocation {
+
+location currentLocation = {
+    -37.8136,          // lat
+    144.9631,          // lon
+    DEFAULT_TIMEZONE,  // timezone
+    "Melbourne"        // default location is in Melbourne
+};
+time_t lastGetLocationTS = 0;
+}  // namespace Watchy_GetLocation
@@ -0,0 +1,127 @@
+#include <Print.h>
+
+#include <stdarg.h>
+#include <stdio.h>
+
+size_t Print::write(const uint8_t *buffer, size_t size) {
+  size_t n = 0;
+  while (size--) {
+    n += write(*buffer++);
+  }
+  return n;
+}
+
+size_t Print::printf(const char *format, ...) {
+  char buf[64];
+  va_list args;
+  va_start(args, format);
+  int len = vsnprintf(buf, sizeof(buf), format, args);
+  va_end(args);
+  if (len < 0) {
+    return 0;
+  }
+  if (size_t(len) < sizeof(buf)) {
+    return write(buf, len);
+  }
+  char *big = new char[len + 1];
+  va_start(args, format);
+  vsnprintf(big, len + 1, format, args);
+  va_end(args);
+  len = write(big, len);
+  delete[] big;
+  return len;
+}
+
+size_t Print::printNumber(unsigned long n, int base, bool negative) {
+  char buf[8 * sizeof(n) + 2];
+  char *p = &buf[sizeof(buf) - 1];
+  *p = '\0';
+  if (base < 2) {
+    base = 10;
+  }
+  do {
+    const unsigned long digit = n % base;
+    *--p = digit < 10 ? '0' + digit : 'A' + digit - 10;
+    n /= base;
+  } while (n);
+  if (negative) {
+    *--p = '-';
+  }
+  return write(p);
+}
+
+size_t Print::print(const __FlashStringHelper *s) {
+  return print(reinterpret_cast<const char *>(s));
+}
+
+size_t Print::print(const String &s) { return write(s.c_str(), s.length()); }
+
+size_t Print::print(const char s[]) { return write(s); }
+
+size_t Print::print(char c) { return write(c); }
+
+size_t Print::print(unsigned char n, int base) {
+  return print((unsigned long)n, base);
+}
+
+size_t Print::print(int n, int base) { return print((long)n, base); }
+
+size_t Print::print(unsigned int n, int base) {
+  return print((unsigned long)n, base);
+}
+
+size_t Print::print(long n, int base) {
+  if (base == 10 && n < 0) {
+    return printNumber(-(unsigned long)n, base, true);
+  }
+  return printNumber(n, base, false);
+}
+
+size_t Print::print(unsigned long n, int base) {
+  return printNumber(n, base, false);
+}
+
+size_t Print::print(double n, int digits) { return printf("%.*f", digits, n); }
+
+size_t Print::print(struct tm *timeinfo, const char *format) {
+  char buf[64];
+  const size_t len =
+      strftime(buf, sizeof(buf), format == nullptr ? "%c" : format, timeinfo);
+  return write(buf, len);
+}
+
+size_t Print::println() { return print("\r\n"); }
+
+size_t Print::println(const __FlashStringHelper *s) {
+  return print(s) + println();
+}
+
+size_t Print::println(const String &s) { return print(s) + println(); }
+
+size_t Print::println(const char s[]) { return print(s) + println(); }
+
+size_t Print::println(char c) { return print(c) + println(); }
+
+size_t Print::println(unsigned char n, int base) {
+  return print(n, base) + println();
+}
+
+size_t Print::println(int n, int base) { return print(n, base) + println(); }
+
+size_t Print::println(unsigned int n, int base) {
+  return print(n, base) + println();
+}
+
+size_t Print::println(long n, int base) { return print(n, base) + println(); }
+
+size_t Print::println(unsigned long n, int base) {
+  return print(n, base) + println();
+}
+
+size_t Print::println(double n, int digits) {
+  return print(n, digits) + println();
+}
+
+size_t Print::println(struct tm *timeinfo, const char *format) {
+  return print(timeinfo, format) + println();
+}
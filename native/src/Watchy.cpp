@@ -0,0 +1,70 @@
+#include "Watchy.h"
+
+#include <vector>
+
+#include "GetLocation.h"
+#include "Screen.h"
+#include "Timer.h"
+
+// The parts of Watchy that the screens use, without the watch. Nothing sleeps
+// or wakes up, and nothing gets sent to the panel: init() is a cold boot that
+// stops once everything is set up, and the screens are drawn into the frame
+// buffer by whoever calls show().
+
+namespace Watchy {
+
+WatchyRTC RTC;
+WatchyDisplay display(GxEPD2_154_D67(CS, DC, RESET, BUSY));
+Screen *screen = nullptr;
+BMA423 sensor;
+bool WIFI_CONFIGURED = false;
+bool BLE_CONFIGURED = false;
+tmElements_t currentTime;
+
+// constructed on first use, like the watch's (see src/Watchy.cpp)
+std::vector<OnWakeCallback> &owcVec() {
+  static std::vector<OnWakeCallback> owcs;
+  return owcs;
+}
+
+void AddOnWakeCallback(const OnWakeCallback owc) { owcVec().push_back(owc); }
+
+void initTime(String datetime) {
+  static bool done;
+  if (done) { return; }
+  RTC.init();
+  RTC.config(datetime);
+  RTC.read(currentTime);
+  setenv("TZ", Watchy_GetLocation::currentLocation.timezone, 1);
+  tzset();
+  time_t t = makeTime(currentTime);
+  setTime(t);
+  done = true;
+}
+
+void init() {
+  initTime();
+  for (auto &owc : owcVec()) {
+    owc(ESP_SLEEP_WAKEUP_UNDEFINED);
+  }
+  Watchy_Timer::Timer::runDue();
+}
+
+void setScreen(Screen *s) {
+  if (s != nullptr) {
+    screen = s;
+  }
+}
+
+void markDirty() {}
+
+bool drawIfDirty() { return false; }
+
+bool showPreparedFrame() { return false; }
+
+const Screen *drawnScreen() { return nullptr; }  // every show() draws it all
+
+bool getWiFi() { return false; }
+
+void releaseWiFi() {}
+}  // namespace Watchy
@@ -0,0 +1,27 @@
+#include "WatchyRTC.h"
+
+#include "config.h"
+
+// The RTC always says it's the same moment, so that every run draws the same
+// frames: 10:09:30 on Tuesday 15 June 2021 in DEFAULT_TIMEZONE.
+const time_t RTC_TIME = 1623715770;
+
+RTC_REFRESH_t WatchyRTC::_refresh = RTC_REFRESH_NONE;
+
+WatchyRTC::WatchyRTC() : rtcType(DS3231) {}
+
+void WatchyRTC::init() {}
+
+void WatchyRTC::config(String datetime) { setRefresh(RTC_REFRESH_MIN); }
+
+void WatchyRTC::clearAlarm() {}
+
+void WatchyRTC::read(tmElements_t &tm) { breakTime(RTC_TIME, tm); }
+
+void WatchyRTC::set(tmElements_t tm) {}
+
+uint8_t WatchyRTC::temperature() { return 20; }
+
+void WatchyRTC::setAlarm(time_t t) {}
+
+void WatchyRTC::setRefresh(RTC_REFRESH_t r) { _refresh = r; }
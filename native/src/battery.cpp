@@ -0,0 +1,7 @@
+#include "battery.h"
+
+namespace Watchy {
+
+// a battery about half full
+float getBatteryVoltage() { return 3.9; }
+}  // namespace Watchy
@@ -0,0 +1,19 @@
+#include "bma.h"
+
+// The accelerometer of a watch lying face up on a table, that has taken a
+// few steps today.
+
+BMA423::BMA423() {}
+
+BMA423::~BMA423() {}
+
+uint8_t BMA423::getDirection() { return DIRECTION_DISP_UP; }
+
+bool BMA423::getAccel(Accel &acc) {
+  acc.x = 12;
+  acc.y = -31;
+  acc.z = -1019;
+  return true;
+}
+
+uint32_t BMA423::getCounter() { return 4321; }
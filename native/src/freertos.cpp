@@ -0,0 +1,72 @@
+#include <FreeRTOS.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+// There is only the one thread natively. Locks are always free, and waiting
+// for something that hasn't already happened would wait forever, so it's a
+// fatal error, like trying to start a task.
+
+static void fatal(const char *what) {
+  fprintf(stderr, "%s: there are no other tasks natively\n", what);
+  abort();
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t code, const char *name,
+                                   uint32_t stackDepth, void *parameters,
+                                   UBaseType_t priority, TaskHandle_t *created,
+                                   BaseType_t coreID) {
+  fatal(name);
+  return pdFAIL;
+}
+
+void vTaskDelete(TaskHandle_t task) {}
+
+void vTaskDelay(TickType_t ticks) { usleep(ticks * portTICK_PERIOD_MS * 1000); }
+
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task) { return 0; }
+
+struct Semaphore {};
+
+SemaphoreHandle_t xSemaphoreCreateMutex() { return new Semaphore(); }
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t s, TickType_t ticks) {
+  return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t s) { return pdTRUE; }
+
+struct EventGroup {
+  EventBits_t bits;
+};
+
+EventGroupHandle_t xEventGroupCreate() { return new EventGroup{0}; }
+
+EventBits_t xEventGroupGetBits(EventGroupHandle_t g) { return g->bits; }
+
+EventBits_t xEventGroupSetBits(EventGroupHandle_t g, EventBits_t bits) {
+  return g->bits |= bits;
+}
+
+EventBits_t xEventGroupClearBits(EventGroupHandle_t g, EventBits_t bits) {
+  const EventBits_t before = g->bits;
+  g->bits &= ~bits;
+  return before;
+}
+
+EventBits_t xEventGroupWaitBits(EventGroupHandle_t g, EventBits_t bits,
+                                BaseType_t clearOnExit, BaseType_t waitForAll,
+                                TickType_t ticks) {
+  const EventBits_t set = g->bits;
+  if (waitForAll ? ((set & bits) != bits) : ((set & bits) == 0)) {
+    if (ticks == portMAX_DELAY) {
+      fatal("xEventGroupWaitBits");
+    }
+    return set;  // timed out
+  }
+  if (clearOnExit) {
+    g->bits &= ~bits;
+  }
+  return set;
+}
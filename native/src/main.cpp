@@ -0,0 +1,30 @@
+// Draws the screens of src/Screens/Faces.cpp whose show() only draws, on the
+// host, and prints the same benchmark output as [env:bench] does on the
+// watch (see src/Bench.h), for tools/bench.py:
+//
+//   pio run -e native && .pio/build/native/program > native.log
+//   tools/bench.py --frames frames native.log
+
+#include "Faces.h"
+#include "Watchy.h"
+
+// the labels of the settings menu in src/Screens/main.cpp, none of the
+// screens behind them are built natively
+MenuItem menuItems[] = {{"Set Time", nullptr},
+                        {"Time Zone", nullptr},
+                        {"Blufi", nullptr},
+                        {"Update (OTA)", nullptr},
+                        {"Update (BLE)", nullptr},
+                        {"Sync Time", nullptr},
+                        {"Set Location", nullptr},
+                        {"Get Weather", nullptr},
+                        {"Buzz", nullptr}};
+MenuScreen menu(menuItems, sizeof(menuItems) / sizeof(menuItems[0]));
+
+#ifndef PIO_UNIT_TESTING  // the tests in test/ have their own
+int main() {
+  Watchy::init();
+  Watchy_Bench::run(benchItems, numBenchItems);
+  return 0;
+}
+#endif
@@ -0,0 +1,46 @@
+#include "Bench.h"
+
+#ifdef WATCHY_BENCH
+
+namespace Watchy_Bench {
+
+const uint8_t RUNS = 5;  // show() timing is the fastest of this many runs
+
+void dumpFrame(const char *name) {
+  const uint8_t *row = Watchy::display.getBuffer();
+  for (uint16_t y = 0; y < DISPLAY_HEIGHT; y++) {
+    Serial.printf("frame %s ", name);
+    for (uint16_t x = 0; x < WatchyDisplay::WIDTH_BYTES; x++) {
+      Serial.printf("%02x", *row++);
+    }
+    Serial.println();
+  }
+}
+
+void run(const Item items[], uint8_t count) {
+  Watchy::initTime();  // screens that show the time need it
+  Serial.printf("bench start %d screens\n", count);
+  for (uint8_t i = 0; i < count; i++) {
+    Screen *s = items[i].screen;
+    uint32_t fastest = UINT32_MAX;
+    for (uint8_t r = 0; r < RUNS; r++) {
+      // same setup as Watchy::showWatchFace
+      Watchy::display.setTextColor(
+          (s->bgColor == GxEPD_WHITE ? GxEPD_BLACK : GxEPD_WHITE));
+      Watchy::display.setCursor(0, 0);
+      Watchy::display.stats = {};
+      const uint32_t start = micros();
+      s->show();
+      fastest = min(fastest, uint32_t(micros() - start));
+    }
+    const WatchyDisplay::Stats &stats = Watchy::display.stats;
+    Serial.printf("bench %s %u us %u pixels %u spans %u glyphs\n",
+                  items[i].name, fastest, stats.pixels, stats.spans,
+                  stats.glyphs);
+    dumpFrame(items[i].name);
+  }
+  Serial.println("bench end");
+}
+};  // namespace Watchy_Bench
+
+#endif
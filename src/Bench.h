@@ -0,0 +1,22 @@
+#pragma once
+
+// Rendering benchmarks, built by [env:bench] in platformio.ini, and by
+// [env:native] to run on the host. Times show() of a list of screens, counts
+// the drawing they do, and dumps the frame each one draws on the serial port.
+// tools/bench.py turns the output into a table and PBM images, and compares
+// it with an earlier run.
+#ifdef WATCHY_BENCH
+
+#include "Screen.h"
+
+namespace Watchy_Bench {
+
+typedef struct {
+  const char *name;  // no spaces, it's used as a file name
+  Screen *screen;    // show() must only draw, no networking
+} Item;
+
+void run(const Item items[], uint8_t count);
+};  // namespace Watchy_Bench
+
+#endif
@@ -24,6 +24,18 @@ const char * IDtoString(ID id) {
     case ALARM_TIMER: return "ALARM_TIMER";
     case LOCATION_UPDATE: return "LOCATION_UPDATE";
     case TIME_SYNC: return "TIME_SYNC";
+    case MENU_BTN_UP: return "MENU_BTN_UP";
+    case BACK_BTN_UP: return "BACK_BTN_UP";
+    case UP_BTN_UP: return "UP_BTN_UP";
+    case DOWN_BTN_UP: return "DOWN_BTN_UP";
+    case MENU_BTN_LONG: return "MENU_BTN_LONG";
+    case BACK_BTN_LONG: return "BACK_BTN_LONG";
+    case UP_BTN_LONG: return "UP_BTN_LONG";
+    case DOWN_BTN_LONG: return "DOWN_BTN_LONG";
+    case MENU_BTN_REPEAT: return "MENU_BTN_REPEAT";
+    case BACK_BTN_REPEAT: return "BACK_BTN_REPEAT";
+    case UP_BTN_REPEAT: return "UP_BTN_REPEAT";
+    case DOWN_BTN_REPEAT: return "DOWN_BTN_REPEAT";
     case MAX: return "MAX";
     default: return "unknown";
   }
@@ -34,6 +46,9 @@ const char * IDtoString(ID id) {
 BackgroundTask handlerTask("handler", nullptr);
 
 void Event::handle() {
+  if (id == NULL_EVENT) {
+    return;  // only sent to wake up Event::wait
+  }
   log_i("%6d handle event %s", millis(), IDtoString(id));
   if (Watchy::screen != nullptr) {
     handlerTask.add();
@@ -54,10 +69,33 @@ void Event::handle() {
         log_i("previous bounces: %d", bounces);
         Watchy::screen->down();
         break;
+      case MENU_BTN_LONG:
+        Watchy::screen->menuLong();
+        break;
+      case BACK_BTN_LONG:
+        Watchy::screen->backLong();
+        break;
+      case UP_BTN_LONG:
+      case UP_BTN_REPEAT:
+        Watchy::screen->upRepeat(repeats);
+        break;
+      case DOWN_BTN_LONG:
+      case DOWN_BTN_REPEAT:
+        Watchy::screen->downRepeat(repeats);
+        break;
+      case MENU_BTN_UP:
+      case BACK_BTN_UP:
+      case UP_BTN_UP:
+      case DOWN_BTN_UP:
+      case MENU_BTN_REPEAT:
+      case BACK_BTN_REPEAT:
+        break;  // no screen needs these yet
       case ALARM_TIMER:
         // resets the alarm flag in the RTC
         Watchy::RTC.clearAlarm();
-        Watchy::showWatchFace(true);
+        if (!Watchy::showPreparedFrame()) {
+          Watchy::markDirty();
+        }
         break;
       case LOCATION_UPDATE:
         Watchy_GetLocation::currentLocation = loc;
@@ -89,9 +127,16 @@ void Event::send() {
 
 void Event::handleAll() {
   Event e;
-  while (xQueueReceive(Q(), &e, 10)) {
+  while (xQueueReceive(Q(), &e, 0)) {
     e.handle();
   }
+  // draw once for everything that was handled
+  Watchy::drawIfDirty();
+}
+
+bool Event::wait(TickType_t timeout) {
+  Event e;
+  return xQueuePeek(Q(), &e, timeout) == pdTRUE;
 }
 
 QueueHandle_t Event::Q() {
@@ -128,7 +173,14 @@ void BackgroundTask::remove() const {
       break;
     }
   }
+  const bool last = tasks.empty();
   xSemaphoreGive(taskVectorLock);
+  if (last) {
+    Event{
+        .id = NULL_EVENT,
+        .micros = micros(),
+    }.send();
+  }
 }
 
 bool BackgroundTask::running() {
@@ -19,6 +19,19 @@ typedef enum {
   ALARM_TIMER,
   LOCATION_UPDATE,
   TIME_SYNC,
+  // each group in the same order as the BTN_DOWNs
+  MENU_BTN_UP,  // released
+  BACK_BTN_UP,
+  UP_BTN_UP,
+  DOWN_BTN_UP,
+  MENU_BTN_LONG,  // held down for a while
+  BACK_BTN_LONG,
+  UP_BTN_LONG,
+  DOWN_BTN_LONG,
+  MENU_BTN_REPEAT,  // still held down after that, faster and faster
+  BACK_BTN_REPEAT,
+  UP_BTN_REPEAT,
+  DOWN_BTN_REPEAT,
   MAX
 } ID;
 
@@ -32,11 +45,17 @@ class Event {
   union {
     Watchy_GetLocation::location loc; // LOCATION_UPDATE
     timeval tv; // TIME_SYNC
-    int bounces; // BTN_DOWN
+    int bounces; // BTN_DOWN, BTN_UP
+    int repeats; // BTN_LONG (0), BTN_REPEAT (1 and up)
   };
   void send();
   void handle();
+  // handles every event that has been sent, then draws the screen if any of
+  // them changed it. Doesn't wait for events.
   static void handleAll();
+  // blocks until there is an event to handle, or timeout ticks have passed.
+  // Returns false on timeout.
+  static bool wait(TickType_t timeout);
   static QueueHandle_t ISR_Q() { return _q; }; // must initialize first
   static QueueHandle_t Q();
 };
@@ -62,6 +81,8 @@ class BackgroundTask {
   ~BackgroundTask();
 
   void add() const;
+  // removing the last one sends a NULL_EVENT, so that whoever is waiting for
+  // the background tasks to finish wakes up
   void remove() const;
   static bool running();
 };
@@ -39,6 +39,167 @@ int16_t charDescent(const char c, const GFXfont *f) {
   return g.yOffset + g.height;
 }
 
+TextBounds textBounds(const char *t, const GFXfont *f) {
+  // start out inverted, like Adafruit_GFX::getTextBounds
+  int16_t minx = 0x7FFF, miny = 0x7FFF, maxx = -1, maxy = -1;
+  int16_t x = 0;
+  for (; *t != '\0'; t++) {
+    const uint8_t c = *t;
+    if ((c < f->first) || (c > f->last)) {
+      continue;
+    }
+    const GFXglyph &g = f->glyph[c - f->first];
+    minx = min(minx, int16_t(x + g.xOffset));
+    miny = min(miny, int16_t(g.yOffset));
+    maxx = max(maxx, int16_t(x + g.xOffset + g.width - 1));
+    maxy = max(maxy, int16_t(g.yOffset + g.height - 1));
+    x += g.xAdvance;
+  }
+  return TextBoundsDetail::done(x, minx, miny, maxx, maxy);
+}
+
+TextBounds fontBounds(const GFXfont *f) {
+  int16_t minx = 0x7FFF, miny = 0x7FFF, maxx = -1, maxy = -1;
+  int16_t advance = 0;
+  for (uint16_t c = f->first; c <= f->last; c++) {
+    const GFXglyph &g = f->glyph[c - f->first];
+    minx = min(minx, int16_t(g.xOffset));
+    miny = min(miny, int16_t(g.yOffset));
+    maxx = max(maxx, int16_t(g.xOffset + g.width - 1));
+    maxy = max(maxy, int16_t(g.yOffset + g.height - 1));
+    advance = max(advance, int16_t(g.xAdvance));
+  }
+  return TextBoundsDetail::done(advance, minx, miny, maxx, maxy);
+}
+
+bool TextLayout::layout(const char *t, const GFXfont *f, int16_t w) {
+  if ((t == _text) && (f == _font) && (w == _width)) {
+    return false;
+  }
+  _text = t;
+  _font = f;
+  _width = w;
+  _lines = 0;
+  if (!t) {
+    return true;
+  }
+  const char *s = t;  // start of the current line
+  while (*s != '\0' && _lines < MAX_LINES) {
+    const char *wordEnd = nullptr;  // end of the last word that fits
+    const char *p = s;
+    int16_t xPos = 0;
+    for (; *p != '\0' && *p != '\n'; p++) {
+      xPos += charWidth(*p, f);
+      if (isspace(*p)) {
+        // whitespace never breaks a line by itself, it's dropped at the break
+        if (p > s && !isspace(p[-1])) {
+          wordEnd = p;
+        }
+      } else if (xPos > w) {
+        break;
+      }
+    }
+    Line &line = _line[_lines++];
+    line.start = s - t;
+    if (*p == '\0' || *p == '\n') {
+      s = *p == '\0' ? p : p + 1;
+    } else if (wordEnd) {
+      // break after the last word that fits, and consume the whitespace
+      p = wordEnd;
+      for (s = p; isspace(*s) && *s != '\n'; s++) {
+      }
+      if (*s == '\n') {
+        s++;
+      }
+    } else {
+      // hard break a word that won't fit on one line (but always take at
+      // least one char or we would never get anywhere)
+      if (p == s) {
+        p++;
+      }
+      s = p;
+    }
+    line.end = p - t;
+    line.descent = INT8_MIN;
+    for (p = t + line.start; p < t + line.end; p++) {
+      if (!isspace(*p)) {
+        line.descent = max(line.descent, int8_t(charDescent(*p, f)));
+      }
+    }
+  }
+  return true;
+}
+
+uint8_t TextLayout::linesThatFit(uint8_t first, int16_t h) const {
+  uint8_t count = 0;
+  for (uint8_t i = first; i < _lines; i++, count++) {
+    if ((count + 1) * _font->yAdvance + _line[i].descent > h) {
+      break;
+    }
+  }
+  return count;
+}
+
+uint8_t TextLayout::pages(int16_t h) const {
+  uint8_t p = 0;
+  for (uint8_t first = 0; first < _lines; p++) {
+    // a line too tall for the box gets a page to itself anyway
+    first += max(linesThatFit(first, h), uint8_t(1));
+  }
+  return p;
+}
+
+uint8_t TextLayout::_pageStart(uint8_t p, int16_t h) const {
+  uint8_t first = 0;
+  for (; p > 0 && first < _lines; p--) {
+    first += max(linesThatFit(first, h), uint8_t(1));
+  }
+  return first;
+}
+
+void TextLayout::drawLines(Adafruit_GFX &g, int16_t x, int16_t y,
+                           uint8_t first, uint8_t count) const {
+  if (!_text) {
+    return;
+  }
+  g.setFont(_font);
+  g.setTextWrap(false);  // clip (GFX used to have a bug that would auto-wrap on
+                         // exact width)
+  for (uint8_t i = first; i < first + count && i < _lines; i++) {
+    y += _font->yAdvance;
+    g.setCursor(x, y);
+    for (uint16_t c = _line[i].start; c < _line[i].end; c++) {
+      g.print(_text[c]);
+    }
+  }
+}
+
+void TextLayout::drawPage(Adafruit_GFX &g, int16_t x, int16_t y, int16_t h,
+                          uint8_t p) const {
+  const uint8_t first = _pageStart(p, h);
+  drawLines(g, x, y, first, max(linesThatFit(first, h), uint8_t(1)));
+}
+
+void TextLayout::drawRegion(Adafruit_GFX &g, int16_t x, int16_t y,
+                            int16_t top, int16_t bottom) const {
+  if (!_text) {
+    return;
+  }
+  uint8_t first = _lines;
+  uint8_t count = 0;
+  for (uint8_t i = 0; i < _lines; i++) {
+    // line i covers the rows from the top of its line box down to its lowest
+    // descender
+    const int16_t lineTop = y + i * _font->yAdvance;
+    const int16_t baseline = lineTop + _font->yAdvance;
+    if ((lineTop < bottom) && (baseline + _line[i].descent > top)) {
+      first = min(first, i);
+      count = i - first + 1;
+    }
+  }
+  drawLines(g, x, y + first * _font->yAdvance, first, count);
+}
+
 /**
  * @brief draw word wrapped text within a bounding box. Takes GFX, bounding box,
  *        text string, and font
@@ -53,68 +214,8 @@ int16_t charDescent(const char c, const GFXfont *f) {
  */
 void drawWordWrappedText(Adafruit_GFX &g, int16_t x, int16_t y, int16_t w,
                          int16_t h, const char *t, const GFXfont *f) {
-  if (!t) {
-    return;
-  }
-  g.setFont(f);
-  g.setTextWrap(false);  // clip (GFX used to have a bug that would auto-wrap on
-                         // exact width)
-  const char *startLine = t;
-  const char *wordBreak = t;
-  int16_t wordBreakXPos = 0;
-  int16_t xPos = 0;            ///< x position relative to left of bounding box
-  int16_t yPos = f->yAdvance;  ///< y position relative to top of bounding box
-  bool inWord = false;
-  for (char c = *t;; c = *++t) {
-    if (c == '\0' || c == '\n') {
-      goto hardBreak; // don't blindly hate gotos.
-    }
-    xPos += charWidth(c, f);
-    if (xPos <= w) {
-      // this character fits within the width
-      if (yPos + charDescent(c, f) > h) {
-        return;
-      }
-      if (isSpace(c)) {
-        inWord = false;
-        wordBreak = t + 1;
-        wordBreakXPos = xPos;
-      } else if (!inWord) {
-        // start of a new word
-        inWord = true;
-        wordBreak = t;
-        wordBreakXPos = xPos - charWidth(c, f);
-      }
-      continue;
-    }
-    // break this line
-    if (startLine == wordBreak) {
-    hardBreak:
-      wordBreak = t;
-      wordBreakXPos = xPos;
-    }
-    xPos -= wordBreakXPos;
-    wordBreakXPos = 0;
-    g.setCursor(x, y + yPos);
-    for (c = *startLine; startLine < wordBreak; c = *++startLine) {
-      g.print(c);
-    }
-    yPos += f->yAdvance;
-    if (c == '\0') {
-      return;
-    }
-    if (isSpace(c)) {
-      // consume any remaining trailing whitespace
-      for (; isspace(c) && c != '\n'; c = *++t) {
-      }
-      startLine = t;
-      xPos = 0;
-      wordBreak = t;
-      wordBreakXPos = 0;
-      if (c == '\n') {
-        c = *++startLine;  // consume the \n
-      }
-    }
-    xPos += charWidth(c, f);
-  }
+  TextLayout layout;
+  layout.invalidate();
+  layout.layout(t, f, w);
+  layout.drawLines(g, x, y, 0, layout.linesThatFit(0, h));
 }
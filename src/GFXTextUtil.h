@@ -2,6 +2,84 @@
 
 #include <Adafruit_GFX.h>
 
+/**
+ * @brief line breaks of a text word wrapped to a given width, so the text can
+ *        be drawn again, a page or a region at a time, without measuring every
+ *        character again. Handles embedded LF, words that won't fit on one
+ *        line (hard wraps), and excess whitespace at line breaks.
+ *
+ *        The layout is keyed on the text pointer, font and width, so if the
+ *        characters of a text are changed in place call invalidate().
+ *
+ *        There is no constructor so that a TextLayout can live in RTC memory
+ *        and survive deep sleep. A static or RTC_DATA_ATTR TextLayout starts
+ *        out empty, any other one must be invalidate()d before use.
+ */
+class TextLayout {
+ public:
+  static const uint8_t MAX_LINES = 48;  ///< any more lines are dropped
+
+  /**
+   * @brief lay out text t in font f for a box w pixels wide, unless that is
+   *        what is already laid out
+   *
+   * @param t text to lay out
+   * @param f font to use
+   * @param w width of bounding box
+   * @return true if the line breaks were (re)computed
+   */
+  bool layout(const char *t, const GFXfont *f, int16_t w);
+  void invalidate() { _text = nullptr; }
+  uint8_t lines() const { return _lines; }
+
+  /**
+   * @brief how many lines, starting at line first, fit entirely within a box h
+   *        pixels high
+   */
+  uint8_t linesThatFit(uint8_t first, int16_t h) const;
+
+  /**
+   * @brief how many pages of h pixels high it takes to show all of the text.
+   *        Each page starts with the line following the previous page.
+   */
+  uint8_t pages(int16_t h) const;
+
+  /**
+   * @brief draw count lines starting at line first, with the top of line
+   *        first at x, y
+   */
+  void drawLines(Adafruit_GFX &g, int16_t x, int16_t y, uint8_t first,
+                 uint8_t count) const;
+
+  /**
+   * @brief draw page p of a box h pixels high with its upper left at x, y
+   */
+  void drawPage(Adafruit_GFX &g, int16_t x, int16_t y, int16_t h,
+                uint8_t p) const;
+
+  /**
+   * @brief draw just the lines that intersect rows top up to bottom of the
+   *        screen, with the top of the first line of text at x, y. y can be
+   *        above top to scroll the text up.
+   */
+  void drawRegion(Adafruit_GFX &g, int16_t x, int16_t y, int16_t top,
+                  int16_t bottom) const;
+
+ private:
+  struct Line {
+    uint16_t start;  ///< offset of the first char of the line
+    uint16_t end;    ///< offset one past the last char of the line
+    int8_t descent;  ///< lowest extent below the baseline of any char
+  };
+  const char *_text;
+  const GFXfont *_font;
+  int16_t _width;
+  uint8_t _lines;
+  Line _line[MAX_LINES];
+
+  uint8_t _pageStart(uint8_t p, int16_t h) const;
+};
+
 /**
  * @brief draw word wrapped text within a bounding box. Takes GFX, bounding box,
  *        text string, and font. Handles embedded LF, words that won't fit on one
@@ -18,3 +96,93 @@
  */
 void drawWordWrappedText(Adafruit_GFX &g, int16_t x, int16_t y, int16_t w,
                          int16_t h, const char *t, const GFXfont *f);
+
+/**
+ * @brief bounds of the ink of a string drawn with the cursor at 0, 0, and how
+ *        far the cursor moves. Same as Adafruit_GFX::getTextBounds (without
+ *        wrapping), for a single line of text.
+ */
+struct TextBounds {
+  int16_t x1, y1;   ///< upper left of the bounding box
+  uint16_t w, h;    ///< size of the bounding box
+  int16_t advance;  ///< cursor movement
+  constexpr int16_t ascent() const { return -y1; }  ///< height above baseline
+  constexpr int16_t descent() const { return y1 + h; }  ///< below baseline
+};
+
+/**
+ * @brief measure a string in one pass over its glyphs
+ *
+ * @param t text to measure
+ * @param f font to use
+ * @return TextBounds of t
+ */
+TextBounds textBounds(const char *t, const GFXfont *f);
+
+/**
+ * @brief bounds of every glyph of a font drawn with the cursor at 0, 0, so
+ *        the ink of any string in the font is between its ascent and descent.
+ *        advance is the widest glyph's.
+ *
+ * @param f font to measure
+ * @return TextBounds of the whole font
+ */
+TextBounds fontBounds(const GFXfont *f);
+
+namespace TextBoundsDetail {
+// C++11 constexpr functions are a single return statement, so the loop over
+// the string is a recursion that carries the bounds so far along with it
+constexpr TextBounds done(int16_t x, int16_t minx, int16_t miny, int16_t maxx,
+                          int16_t maxy) {
+  return TextBounds{maxx >= minx ? minx : int16_t(0),
+                    maxy >= miny ? miny : int16_t(0),
+                    uint16_t(maxx >= minx ? maxx - minx + 1 : 0),
+                    uint16_t(maxy >= miny ? maxy - miny + 1 : 0), x};
+}
+
+constexpr int16_t lesser(int16_t a, int16_t b) { return a < b ? a : b; }
+constexpr int16_t greater(int16_t a, int16_t b) { return a > b ? a : b; }
+
+template <size_t N>
+constexpr TextBounds next(const char *t, const GFXglyph (&glyphs)[N],
+                          uint16_t first, int16_t x, int16_t minx,
+                          int16_t miny, int16_t maxx, int16_t maxy);
+
+template <size_t N>
+constexpr TextBounds glyph(const char *t, const GFXglyph (&glyphs)[N],
+                           uint16_t first, const GFXglyph &g, int16_t x,
+                           int16_t minx, int16_t miny, int16_t maxx,
+                           int16_t maxy) {
+  return next(t + 1, glyphs, first, x + g.xAdvance,
+              lesser(minx, x + g.xOffset), lesser(miny, g.yOffset),
+              greater(maxx, x + g.xOffset + g.width - 1),
+              greater(maxy, g.yOffset + g.height - 1));
+}
+
+template <size_t N>
+constexpr TextBounds next(const char *t, const GFXglyph (&glyphs)[N],
+                          uint16_t first, int16_t x, int16_t minx,
+                          int16_t miny, int16_t maxx, int16_t maxy) {
+  return *t == '\0' ? done(x, minx, miny, maxx, maxy)
+         : (uint8_t(*t) < first || uint8_t(*t) >= first + N)
+             ? next(t + 1, glyphs, first, x, minx, miny, maxx, maxy)
+             : glyph(t, glyphs, first, glyphs[uint8_t(*t) - first], x, minx,
+                     miny, maxx, maxy);
+}
+}  // namespace TextBoundsDetail
+
+/**
+ * @brief measure a string at compile time. Same as textBounds(t, f), but
+ *        takes the glyph table of the font (which has to be constexpr) and
+ *        the first char in it, instead of the font.
+ *
+ * @param t text to measure
+ * @param glyphs glyph table of the font to use
+ * @param first first char in the glyph table
+ * @return TextBounds of t
+ */
+template <size_t N>
+constexpr TextBounds textBounds(const char *t, const GFXglyph (&glyphs)[N],
+                                uint16_t first) {
+  return TextBoundsDetail::next(t, glyphs, first, 0, 0x7FFF, 0x7FFF, -1, -1);
+}
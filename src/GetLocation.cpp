@@ -3,6 +3,7 @@
 #include <Arduino_JSON.h>
 #include <IPAddress.h>
 
+#include "Timer.h"
 #include "Watchy.h"  // for connectWiFi
 #include "WatchyErrors.h"
 
@@ -10,12 +11,14 @@ namespace Watchy_GetLocation {
 
 constexpr const float DEFAULT_LOCATION_LATITUDE = -37.8136;
 constexpr const float DEFAULT_LOCATION_LONGDITUDE = 144.9631;
-const int LOCATION_UPDATE_INTERVAL = 5 * 60 * 1000;  // 5 minutes in millis
+const time_t LOCATION_UPDATE_INTERVAL = 5 * 60;  // 5 minutes in seconds
 
 const char *TZDB_UDP_HOST = "timezoned.rop.nl";
 const int TZDB_UDP_PORT = 2342;
 
-RTC_DATA_ATTR time_t lastGetLocationTS = 0;  // can use this to throttle
+RTC_DATA_ATTR time_t lastGetLocationTS = 0;
+RTC_DATA_ATTR bool timezoneSelected = false;
+Watchy_Timer::Timer locationThrottle("location");
 RTC_DATA_ATTR location currentLocation = {
     DEFAULT_LOCATION_LATITUDE,       // lat
     DEFAULT_LOCATION_LONGDITUDE,     // lon
@@ -25,6 +28,7 @@ RTC_DATA_ATTR location currentLocation = {
 
 // built from tzdb version 2021a
 
+#include <ctype.h>
 #include <string.h>
 
 const char *posix[] = {
@@ -130,6 +134,103 @@ const char *posix[] = {
     /*  99 */ "SST11",
     /* 100 */ "<+11>-11<+12>,M10.1.0,M4.1.0/3",
 };
+const uint16_t numPosix = sizeof(posix) / sizeof(posix[0]);
+
+// copies the zone abbreviation at p into out, without the <> around a
+// numeric one, and returns what follows it
+static const char *readAbbreviation(const char *p, char *out, size_t n) {
+  const char *end;
+  if (*p == '<') {
+    end = strchr(++p, '>');
+  } else {
+    for (end = p; isalpha(*end); end++) {
+    }
+  }
+  snprintf(out, n, "%.*s", int(end - p), p);
+  return (*end == '>') ? end + 1 : end;
+}
+
+static bool isOffset(const char *abbreviation) {
+  return (*abbreviation == '+') || (*abbreviation == '-') ||
+         isdigit(*abbreviation);
+}
+
+// the label for a spec, before telling apart the ones that look the same
+static void describe(const char *spec, char *out, size_t n) {
+  static const char *months[] = {"Jan", "Feb", "Mar", "Apr", "May", "Jun",
+                                 "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+  char std[12], dst[12] = "";
+  const char *p = readAbbreviation(spec, std, sizeof(std));
+  // POSIX offsets are hours west of UTC, labels have hours east
+  const char sign = (*p == '-') ? '+' : '-';
+  if ((*p == '-') || (*p == '+')) {
+    p++;
+  }
+  char *end;
+  const long hours = strtol(p, &end, 10);
+  const long minutes = (*end == ':') ? strtol(end + 1, &end, 10) : 0;
+  p = end;
+  if ((*p != ',') && (*p != '\0')) {
+    readAbbreviation(p, dst, sizeof(dst));
+  }
+
+  // just the offset, "UTC" itself is too wide for the menu
+  int len;
+  if (minutes != 0) {
+    len = snprintf(out, n, "%c%ld:%02ld", sign, hours, minutes);
+  } else if (hours != 0) {
+    len = snprintf(out, n, "%c%ld", sign, hours);
+  } else {
+    len = snprintf(out, n, "UTC");
+  }
+  const bool named = !isOffset(std);
+  const bool dstNamed = named && (dst[0] != '\0') && !isOffset(dst);
+  if (named) {
+    len += snprintf(out + len, n - len, " %s", std);
+  }
+  if (dstNamed) {
+    len += snprintf(out + len, n - len, "/%s", dst);
+  }
+  p = strchr(p, ',');
+  if (p == nullptr) {
+    return;  // no daylight saving
+  }
+  // the month of the start rule: Mm.w.d, or a day of the year, Jn (no leap
+  // day) or n (from 0)
+  int month;
+  if (p[1] == 'M') {
+    month = atoi(p + 2) - 1;
+  } else {
+    static const int monthEnds[] = {31,  59,  90,  120, 151, 181,
+                                    212, 243, 273, 304, 334, 365};
+    const int day = (p[1] == 'J') ? atoi(p + 2) : atoi(p + 1) + 1;
+    for (month = 0; (month < 11) && (day > monthEnds[month]); month++) {
+    }
+  }
+  if ((month >= 0) && (month < 12)) {
+    snprintf(out + len, n - len, "%s%s", dstNamed ? " " : " DST ",
+             months[month]);
+  }
+}
+
+const char *posixLabel(uint16_t i) {
+  static char label[32];
+  char other[sizeof(label)];
+  describe(posix[i], label, sizeof(label));
+  uint16_t same = 0, before = 0;
+  for (uint16_t j = 0; j < numPosix; j++) {
+    describe(posix[j], other, sizeof(other));
+    if (strcmp(label, other) == 0) {
+      same++;
+      before += (j < i);
+    }
+  }
+  if (same > 1) {
+    const size_t len = strlen(label);
+    snprintf(label + len, sizeof(label) - len, " #%u", before + 1);
+  }
+  return label;
+}
 
 const uint32_t mask = 0x1fffff;
 
@@ -779,7 +880,7 @@ const char *getPosixTZforOlson(const char *olson) {
 void getLocation() {
   // http://ip-api.com/json?fields=57792
   // {"status":"success","lat":-27.4649,"lon":153.028,"timezone":"Australia/Brisbane","query":"202.144.174.72"}
-  if (now() - lastGetLocationTS < LOCATION_UPDATE_INTERVAL) {  // too soon
+  if (locationThrottle.pending()) {  // too soon
     log_i("%ld-%ld=%ld", now(), lastGetLocationTS, now() - lastGetLocationTS);
     Watchy::err = Watchy::RATE_LIMITED;
     return;
@@ -812,7 +913,9 @@ void getLocation() {
       strncpy(loc.city, responseObject["city"], sizeof(loc.city));
 
       const char* olsonTZ = static_cast<const char *>(responseObject["timezone"]);
-      loc.timezone = getPosixTZforOlson(olsonTZ);
+      // a time zone picked by hand is kept
+      loc.timezone = timezoneSelected ? currentLocation.timezone
+                                      : getPosixTZforOlson(olsonTZ);
       if ( loc.timezone ) {
         Watchy_Event::Event{
             .id = Watchy_Event::LOCATION_UPDATE,
@@ -820,6 +923,7 @@ void getLocation() {
             {.loc = loc},
         }.send();
         lastGetLocationTS = now();
+        locationThrottle.in(LOCATION_UPDATE_INTERVAL);
         Watchy::err = Watchy::OK;
       } else {
         log_e("getPosixTZForOlson failed");
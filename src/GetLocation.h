@@ -1,5 +1,6 @@
 #pragma once
 
+#include <stdint.h>
 #include <time.h>
 namespace Watchy_GetLocation {
 
@@ -13,6 +14,21 @@ typedef struct {
 extern location currentLocation;
 extern time_t lastGetLocationTS; // timestamp of last successful getLocation
 
+// every POSIX tz spec getLocation can pick, for choosing one by hand
+extern const char *posix[];
+extern const uint16_t numPosix;
+// a readable label for posix[i], like "+10 AEST/AEDT Oct": the offset from
+// UTC, the zone's abbreviations if they are names rather than offsets, and
+// the month daylight saving starts in. Only the hashes of the tz database
+// names are kept, so the label is worked out from the spec itself. Specs
+// that still look the same (they only differ in the day or hour daylight
+// saving starts or ends) are numbered. Only lasts until the next call.
+const char *posixLabel(uint16_t i);
+
+// the time zone was picked by hand, so getLocation keeps it rather than the
+// one it looks up for the IP address
+extern bool timezoneSelected;
+
 // sends update event on success
 void getLocation();
 }  // namespace Watchy_GetLocation
@@ -3,6 +3,7 @@
 #include <Arduino_JSON.h>
 
 #include "GetLocation.h"
+#include "Timer.h"
 #include "Watchy.h"
 #include "WatchyErrors.h"
 #include "config.h"  // should be first
@@ -11,11 +12,11 @@ namespace Watchy_GetWeather {
 RTC_DATA_ATTR weatherData currentWeather = {.temperature = 22,
                                             .weatherConditionCode = 800};
 RTC_DATA_ATTR time_t lastGetWeatherTS = 0;
+Watchy_Timer::Timer weatherThrottle("weather");
 
 weatherData getWeather() {
   // only update if WEATHER_UPDATE_INTERVAL has elapsed i.e. 30 minutes
-  if (lastGetWeatherTS &&
-      (now() - lastGetWeatherTS < WEATHER_UPDATE_INTERVAL)) {
+  if (weatherThrottle.pending()) {
     // too soon to update, just re-use existing values. Not an error
     Watchy::err = Watchy::RATE_LIMITED;
     return currentWeather;
@@ -61,6 +62,7 @@ weatherData getWeather() {
       strncpy(currentWeather.weatherCity, Watchy_GetLocation::currentLocation.city,
               sizeof(currentWeather.weatherCity));
       lastGetWeatherTS = now();
+      weatherThrottle.in(WEATHER_UPDATE_INTERVAL);
       Watchy::err = Watchy::OK;
     } else {
       Watchy::err = Watchy::REQUEST_FAILED;
@@ -9,7 +9,7 @@ constexpr const char* OPENWEATHERMAP_APIKEY =
 constexpr const char* OPENWEATHERMAP_URL =
     "http://api.openweathermap.org/data/2.5/weather";
 constexpr const char* TEMP_UNIT = "metric";  // use "imperial" for Fahrenheit"
-const int WEATHER_UPDATE_INTERVAL = 30 * 60 * 1000;  // 30 minutes in millis
+const time_t WEATHER_UPDATE_INTERVAL = 30 * 60;  // 30 minutes in seconds
 
 typedef struct weatherData {
   int8_t temperature;
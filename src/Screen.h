@@ -9,10 +9,52 @@ class Screen {
  public:
   Screen* parent;
   uint16_t bgColor;
-  Screen(uint16_t bg = GxEPD_WHITE) : parent(nullptr), bgColor(bg){};
+  // screens are globals, so parent starts out nullptr without being set here.
+  // A carousel or menu that sets it may be constructed first, in another file
+  // (see Screens/Faces.h).
+  Screen(uint16_t bg = GxEPD_WHITE) : bgColor(bg){};
   virtual void show() = 0;  // display this screen
+  // draw what this screen will show at time t, if that is known ahead of
+  // time, so the frame can be drawn before going to sleep. Returns false,
+  // having drawn nothing, if it isn't.
+  virtual bool showAt(time_t t) { return false; }
+  // for a screen that refreshes with RTC_REFRESH_ALARM, the first time after t
+  // that what show() draws changes. The RTC alarm is set for it when going to
+  // sleep. 0 if only a button press changes it. Data that changes at times
+  // that aren't known ahead can mark the screen dirty from a Watchy_Timer.
+  virtual time_t nextChange(time_t t) const { return 0; }
+  // changes whenever what show() draws does, so a frame drawn ahead of time
+  // can be kept until it does. 0 if show() can draw something different every
+  // time, so its frames can't be kept.
+  virtual uint32_t frameVersion() const { return 0; }
+  // the refresh show() asks the RTC for, so a frame drawn ahead of time with
+  // showAt() can be shown later with the refresh that goes with it. Only
+  // needs overriding by screens with a frameVersion() that don't want
+  // RTC_REFRESH_NONE.
+  virtual RTC_REFRESH_t refreshMode() const { return RTC_REFRESH_NONE; }
+  // called just before going to deep sleep, once the screen has been drawn,
+  // for drawing ahead of time what a button press will want next. Whatever
+  // it leaves in the frame buffer is thrown away.
+  virtual void beforeSleep() {}
+  // whether enough ghosting has built up, over this many partial refreshes
+  // changing this many pixels since the last full refresh, for this screen to
+  // want a full refresh. It only gets one at a cheap moment: when it is
+  // switched to, or on a time tick during FULL_REFRESH_QUIET_HOUR.
+  virtual bool needsFullRefresh(uint16_t partialRefreshes,
+                                uint32_t changedPixels) const {
+    return (partialRefreshes >= 500) ||
+           (changedPixels >= 50UL * DISPLAY_WIDTH * DISPLAY_HEIGHT);
+  }
   virtual void up() {}
   virtual void down() {}
   virtual void back() { Watchy::setScreen(parent); }
   virtual void menu() {}
+  // up or down held down: called once it's been held a while, with n = 0,
+  // then over and over, faster and faster, until it's let go. By default
+  // it's pressed again each time.
+  virtual void upRepeat(uint16_t n) { up(); }
+  virtual void downRepeat(uint16_t n) { down(); }
+  // menu or back held down for a while
+  virtual void menuLong() {}
+  virtual void backLong() {}
 };
\ No newline at end of file
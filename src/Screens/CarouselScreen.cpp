@@ -5,6 +5,9 @@
 using namespace Watchy;
 
 RTC_DATA_ATTR int8_t CarouselScreen::index;
+RTC_DATA_ATTR CarouselScreen::CachedSplash
+    CarouselScreen::cached[CACHE_SLOTS] = {{-1}, {-1}};
+RTC_DATA_ATTR uint8_t CarouselScreen::cache[CACHE_SLOTS][SLOT_BYTES];
 
 CarouselScreen::CarouselScreen(CarouselItem *cis, const int8_t cs, uint16_t bg) : Screen(bg), items(cis), size(cs) {
   for (int i = 0; i < size; i++) {
@@ -19,9 +22,90 @@ CarouselScreen::CarouselScreen(CarouselItem *cis, const int8_t cs, uint16_t bg)
 
 void CarouselScreen::show() {
   // Watchy::showWatchFace(true, items[index].splash);
+  const int8_t slot = cachedSlot(index);
+  if ((slot >= 0) && display.unpackFrame(cache[slot], cached[slot].size)) {
+    log_d("cached splash %d", index);
+    RTC.setRefresh(cached[slot].refresh);
+    return;
+  }
   items[index].splash->show();
 }
 
+bool CarouselScreen::showAt(time_t t) {
+  return items[index].splash->showAt(t);
+}
+
+RTC_REFRESH_t CarouselScreen::refreshMode() const {
+  return items[index].splash->refreshMode();
+}
+
+time_t CarouselScreen::nextChange(time_t t) const {
+  return items[index].splash->nextChange(t);
+}
+
+int8_t CarouselScreen::cachedSlot(int8_t i) const {
+  const uint32_t version = items[i].splash->frameVersion();
+  for (uint8_t slot = 0; slot < CACHE_SLOTS; slot++) {
+    if ((cached[slot].index == i) && (cached[slot].size != 0) &&
+        (version != 0) && (cached[slot].version == version)) {
+      return slot;
+    }
+  }
+  return -1;
+}
+
+void CarouselScreen::cacheSplash(int8_t i, uint8_t slot) {
+  Screen *splash = items[i].splash;
+  cached[slot].index = i;
+  cached[slot].size = 0;
+  cached[slot].version = splash->frameVersion();
+  if (cached[slot].version == 0) {
+    return;  // can't be drawn ahead of time
+  }
+  // draw it the way showWatchFace would
+  display.setTextColor(
+      (splash->bgColor == GxEPD_WHITE ? GxEPD_BLACK : GxEPD_WHITE));
+  display.setCursor(0, 0);
+  if (!splash->showAt(now())) {
+    // only show() can draw it, and that asks the RTC for the splash's
+    // refresh, so the current splash's has to be put back
+    const RTC_REFRESH_t refresh = RTC.refresh();
+    splash->show();
+    RTC.setRefresh(refresh);
+  }
+  cached[slot].refresh = splash->refreshMode();
+  cached[slot].size = display.packFrame(cache[slot], SLOT_BYTES);
+  log_d("cached splash %d in slot %d, %d bytes", i, slot, cached[slot].size);
+}
+
+void CarouselScreen::beforeSleep() {
+  const int8_t neighbours[CACHE_SLOTS] = {
+      int8_t(index > 0 ? index - 1 : size - 1),
+      int8_t(index < size - 1 ? index + 1 : 0)};
+  bool keep[CACHE_SLOTS] = {};
+  bool missing[CACHE_SLOTS] = {};
+  for (uint8_t n = 0; n < CACHE_SLOTS; n++) {
+    const int8_t slot = cachedSlot(neighbours[n]);
+    if (slot >= 0) {
+      keep[slot] = true;
+    } else {
+      missing[n] = (neighbours[n] != index);
+    }
+  }
+  // draw the missing ones into slots that aren't holding a neighbour
+  uint8_t slot = 0;
+  for (uint8_t n = 0; n < CACHE_SLOTS; n++) {
+    if (!missing[n] || ((n > 0) && (neighbours[n] == neighbours[0]))) {
+      continue;
+    }
+    while (keep[slot]) {
+      slot++;
+    }
+    cacheSplash(neighbours[n], slot);
+    keep[slot] = true;
+  }
+}
+
 void CarouselScreen::menu() {
   if (items[index].child != nullptr) {
     Watchy::setScreen(items[index].child);
@@ -30,7 +114,7 @@ void CarouselScreen::menu() {
 
 void CarouselScreen::back() {
   index = 0;
-  Watchy::showWatchFace(true);
+  Watchy::markDirty();
 }
 
 void CarouselScreen::up() {
@@ -38,7 +122,7 @@ void CarouselScreen::up() {
   if (index < 0) {
     index = size - 1;
   }
-  Watchy::showWatchFace(true);
+  Watchy::markDirty();
 }
 
 void CarouselScreen::down() {
@@ -46,5 +130,5 @@ void CarouselScreen::down() {
   if (index >= size) {
     index = 0;
   }
-  Watchy::showWatchFace(true);
+  Watchy::markDirty();
 }
@@ -16,9 +16,30 @@ class CarouselScreen : public Screen {
   int8_t size;
   static bool active;
 
+  // the splashes either side of the current one are drawn before going to
+  // sleep and kept packed in RTC memory, so that up or down only has to
+  // unpack one
+  typedef struct {
+    int8_t index;  // of the item, -1 if empty
+    RTC_REFRESH_t refresh;  // the splash's refreshMode()
+    uint16_t size;  // packed bytes, 0 if empty
+    uint32_t version;  // the splash's frameVersion() when it was drawn
+  } CachedSplash;
+  static const uint8_t CACHE_SLOTS = 2;
+  static const uint16_t SLOT_BYTES = CAROUSEL_CACHE_BYTES / CACHE_SLOTS;
+  static CachedSplash cached[CACHE_SLOTS];
+  static uint8_t cache[CACHE_SLOTS][SLOT_BYTES];
+
+  int8_t cachedSlot(int8_t i) const;  // -1 if item i's splash isn't cached
+  void cacheSplash(int8_t i, uint8_t slot);
+
  public:
   CarouselScreen(CarouselItem *cis, const int8_t cs, uint16_t bg = GxEPD_WHITE);
   void show() override;
+  bool showAt(time_t t) override;
+  RTC_REFRESH_t refreshMode() const override;
+  time_t nextChange(time_t t) const override;
+  void beforeSleep() override;
   void menu() override;
   void back() override;
   void up() override;
@@ -0,0 +1,80 @@
+#include "Faces.h"
+
+#include "GFXTextUtil.h"
+#include "OptimaLTStd22pt7b.h"
+#include "icons.h"
+
+TimeScreen timeScreen;
+// measure a label at compile time
+constexpr TextBounds label22pt(const char *label) {
+  return textBounds(label, OptimaLTStd22pt7bGlyphs, 0x20);
+}
+constexpr TextBounds batteryLabel = label22pt("battery");
+constexpr TextBounds stepsLabel = label22pt("steps");
+constexpr TextBounds orientationLabel = label22pt("orientation");
+constexpr TextBounds bluetoothLabel = label22pt("bluetooth");
+constexpr TextBounds wifiLabel = label22pt("wifi");
+constexpr TextBounds settingsLabel = label22pt("settings");
+constexpr TextBounds textLabel = label22pt("wrap text");
+constexpr TextBounds weatherLabel = label22pt("weather");
+IconScreen battery(&rle_battery, "battery", OptimaLTStd22pt7b, batteryLabel);
+IconScreen steps(&rle_steps, "steps", OptimaLTStd22pt7b, stepsLabel);
+IconScreen orientation(&rle_orientation, "orientation", OptimaLTStd22pt7b, orientationLabel);
+IconScreen bluetooth(&rle_bluetooth, "bluetooth", OptimaLTStd22pt7b, bluetoothLabel);
+IconScreen wifi(&rle_wifi, "wifi", OptimaLTStd22pt7b, wifiLabel);
+IconScreen settings(&rle_settings, "settings", OptimaLTStd22pt7b, settingsLabel);
+IconScreen text(&rle_text, "wrap text", OptimaLTStd22pt7b, textLabel);
+ImageScreen weather(cloud, 96, 96, "weather", OptimaLTStd22pt7b, weatherLabel);
+ShowBatteryScreen showBattery;
+ShowOrientationScreen showOrientation;
+ShowStepsScreen showSteps;
+WrappedTextScreen wrappedTextScreen(
+    "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod "
+    "tempor incididunt ut labore et dolore magna aliqua. Ut enim ad minim "
+    "veniam, quis nostrud exercitation ullamco laboris nisi ut aliquip ex ea "
+    "commodo consequat. Duis aute irure dolor in reprehenderit in voluptate "
+    "velit esse cillum dolore eu fugiat nulla pariatur.",
+    "n0-=-5p4c35,.,withaverylongwordthatshouldbehardwrapped?\n\nnotice how "
+    "it goes away on screen refresh?        \t    \t         \r                "
+    "      \n     that's deep sleep.");
+
+#ifdef WATCHY_BENCH
+// the cloud drawn by Adafruit_GFX a pixel at a time, or blitted by
+// WatchyDisplay, to time one against the other. They draw the same frame.
+class CloudScreen : public Screen {
+  const bool blit;
+
+ public:
+  CloudScreen(bool b) : Screen(GxEPD_WHITE), blit(b) {}
+  void show() override {
+    Watchy::display.fillScreen(bgColor);
+    const int16_t x = (DISPLAY_WIDTH - 96) / 2, y = (DISPLAY_HEIGHT - 96) / 2;
+    if (blit) {
+      Watchy::display.drawBitmap(x, y, cloud, 96, 96, GxEPD_BLACK);
+    } else {
+      Watchy::display.Adafruit_GFX::drawBitmap(x, y, cloud, 96, 96,
+                                               GxEPD_BLACK);
+    }
+  }
+};
+CloudScreen cloudGFX(false);
+CloudScreen cloudBlit(true);
+
+const Watchy_Bench::Item benchItems[] = {{"time", &timeScreen},
+                                         {"weather", &weather},
+                                         {"battery", &battery},
+                                         {"steps", &steps},
+                                         {"orientation", &orientation},
+                                         {"text", &text},
+                                         {"bluetooth", &bluetooth},
+                                         {"wifi", &wifi},
+                                         {"settings", &settings},
+                                         {"showBattery", &showBattery},
+                                         {"showSteps", &showSteps},
+                                         {"showOrientation", &showOrientation},
+                                         {"wrappedText", &wrappedTextScreen},
+                                         {"menu", &menu},
+                                         {"cloudGFX", &cloudGFX},
+                                         {"cloudBlit", &cloudBlit}};
+const uint8_t numBenchItems = sizeof(benchItems) / sizeof(benchItems[0]);
+#endif
@@ -0,0 +1,41 @@
+#pragma once
+
+// the screens whose show() only draws: the carousel's splashes, and the
+// screens behind them that don't need the network or the radio. Defined once
+// in Faces.cpp, for the watch (main.cpp) and for the host bench (native/),
+// so the bench always draws what the watch does.
+
+#include "Bench.h"
+#include "IconScreen.h"
+#include "ImageScreen.h"
+#include "MenuScreen.h"
+#include "ShowBatteryScreen.h"
+#include "ShowOrientationScreen.h"
+#include "ShowStepsScreen.h"
+#include "TimeScreen.h"
+#include "WrappedTextScreen.h"
+
+extern TimeScreen timeScreen;
+extern IconScreen battery;
+extern IconScreen steps;
+extern IconScreen orientation;
+extern IconScreen bluetooth;
+extern IconScreen wifi;
+extern IconScreen settings;
+extern IconScreen text;
+extern ImageScreen weather;
+extern ShowBatteryScreen showBattery;
+extern ShowOrientationScreen showOrientation;
+extern ShowStepsScreen showSteps;
+extern WrappedTextScreen wrappedTextScreen;
+
+// the settings menu. Its items lead to screens that aren't built natively,
+// so it's defined by main.cpp, and by native/src/main.cpp with the same
+// labels and no screens behind them.
+extern MenuScreen menu;
+
+#ifdef WATCHY_BENCH
+// every screen whose show() only draws
+extern const Watchy_Bench::Item benchItems[];
+extern const uint8_t numBenchItems;
+#endif
@@ -1,26 +1,30 @@
 #pragma once
 
 #include "Adafruit_GFX.h"
+#include "GFXTextUtil.h"
 #include "Screen.h"
 #include "rle.h"
 
 class IconScreen : public Screen {
  protected:
-  const rle *rleImage;
+  const rle2 *rleImage;
   const char *label;
   const GFXfont *font;
+  const TextBounds labelBounds;  // of label in font
 
  public:
-  IconScreen(const rle *r, const char *l, const GFXfont *f, uint16_t bg = GxEPD_WHITE) : Screen(bg), rleImage(r), label(l), font(f) {}
+  IconScreen(const rle2 *r, const char *l, const GFXfont *f, const TextBounds &b, uint16_t bg = GxEPD_WHITE) : Screen(bg), rleImage(r), label(l), font(f), labelBounds(b) {}
   void show() override {
     log_i("%s", label);
     Watchy::RTC.setRefresh(RTC_REFRESH_NONE); // static screen
+    showAt(now());
+  }
+  bool showAt(time_t t) override {  // the same at any time
     const uint16_t fgColor =
         (bgColor == GxEPD_WHITE ? GxEPD_BLACK : GxEPD_WHITE);
     Watchy::display.setFont(font);
-    int16_t x1, y1;
-    uint16_t w, h;
-    Watchy::display.getTextBounds(label, 0, 0, &x1, &y1, &w, &h);
+    const int16_t y1 = labelBounds.y1;
+    const uint16_t w = labelBounds.w, h = labelBounds.h;
     Watchy::display.fillScreen(bgColor);
     // even space between top<->icon<->label<->bottom
     int space = (DISPLAY_HEIGHT - (rleImage->h + h)) / 3;
@@ -29,5 +33,7 @@ class IconScreen : public Screen {
     // want y1+h to be space above DISPLAY_HEIGHT
     Watchy::display.setCursor((DISPLAY_WIDTH - w) / 2, (DISPLAY_HEIGHT - space - (y1 + h)));
     Watchy::display.print(label);
+    return true;
   }
+  uint32_t frameVersion() const override { return 1; }  // never changes
 };
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Adafruit_GFX.h"
+#include "GFXTextUtil.h"
 #include "Screen.h"
 
 class ImageScreen : public Screen {
@@ -9,20 +10,23 @@ class ImageScreen : public Screen {
   const uint8_t width, height;
   const char *label;
   const GFXfont *font;
+  const TextBounds labelBounds;  // of label in font
 
  public:
   ImageScreen(const uint8_t b[], const uint8_t w, const uint8_t h, const char *l,
-              const GFXfont *f, uint16_t bg = GxEPD_WHITE)
-      : Screen(bg), bitmap(b), width(w), height(h), label(l), font(f) {}
+              const GFXfont *f, const TextBounds &lb, uint16_t bg = GxEPD_WHITE)
+      : Screen(bg), bitmap(b), width(w), height(h), label(l), font(f), labelBounds(lb) {}
   void show() override {
     log_i("%s", label);
     Watchy::RTC.setRefresh(RTC_REFRESH_NONE);  // static screen
+    showAt(now());
+  }
+  bool showAt(time_t t) override {  // the same at any time
     const uint16_t fgColor =
         (bgColor == GxEPD_WHITE ? GxEPD_BLACK : GxEPD_WHITE);
     Watchy::display.setFont(font);
-    int16_t x1, y1;
-    uint16_t w, h;
-    Watchy::display.getTextBounds(label, 0, 0, &x1, &y1, &w, &h);
+    const int16_t y1 = labelBounds.y1;
+    const uint16_t w = labelBounds.w, h = labelBounds.h;
     Watchy::display.fillScreen(bgColor);
     // even space between top<->icon<->label<->bottom
     int space = (DISPLAY_HEIGHT - (height + h)) / 3;
@@ -30,5 +34,7 @@ class ImageScreen : public Screen {
     // want y1+h to be space above DISPLAY_HEIGHT
     Watchy::display.setCursor((DISPLAY_WIDTH - w) / 2, (DISPLAY_HEIGHT - space - (y1 + h)));
     Watchy::display.print(label);
+    return true;
   }
+  uint32_t frameVersion() const override { return 1; }  // never changes
 };
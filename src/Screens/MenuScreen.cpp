@@ -2,15 +2,23 @@
 
 #include "Watchy.h"
 #include "Events.h"
+#include "GFXTextUtil.h"
 
 using namespace Watchy;
 
-RTC_DATA_ATTR int8_t MenuScreen::first;
-RTC_DATA_ATTR int8_t MenuScreen::index;
+RTC_DATA_ATTR MenuScreen::State MenuScreen::states[MAX_MENUS];
+uint8_t MenuScreen::numMenus;
 
-MenuScreen::MenuScreen(MenuItem *mis, const int8_t ms, const GFXfont *f,
+MenuScreen::MenuScreen(MenuItem *mis, const uint16_t ms, const GFXfont *f,
                        uint16_t bg)
-    : Screen(bg), items(mis), size(ms), font(f) {
+    : Screen(bg),
+      state(states[numMenus++]),
+      items(mis),
+      itemName(nullptr),
+      itemSelected(nullptr),
+      size(ms),
+      font(f) {
+  assert(numMenus <= MAX_MENUS);
   for (int i = 0; i < size; i++) {
     if (items[i].screen != nullptr) {
       items[i].screen->parent = this;
@@ -18,79 +26,138 @@ MenuScreen::MenuScreen(MenuItem *mis, const int8_t ms, const GFXfont *f,
   }
 }
 
+MenuScreen::MenuScreen(MenuItemName n, MenuItemSelected s, const uint16_t ms,
+                       const GFXfont *f, uint16_t bg)
+    : Screen(bg),
+      state(states[numMenus++]),
+      items(nullptr),
+      itemName(n),
+      itemSelected(s),
+      size(ms),
+      font(f) {
+  assert(numMenus <= MAX_MENUS);
+}
+
+const char *MenuScreen::name(uint16_t i) const {
+  return items ? items[i].name : itemName(i);
+}
+
 void MenuScreen::show() {
-  log_i("%s", items[index].name);
+  int16_t &first = state.first, &index = state.index;
+  log_i("%s", name(index));
   Watchy::RTC.setRefresh(RTC_REFRESH_NONE);  // static screen
-  const uint16_t fgColor =
-      (screen->bgColor == GxEPD_WHITE ? GxEPD_BLACK : GxEPD_WHITE);
-  Watchy::display.fillScreen(bgColor);
   display.setFont(font);
-  const uint16_t menuLineHeight = font->yAdvance * 15 / 10; // 50% padding
-  int16_t yPos = 0;
-  for (uint8_t i = 0; i < min(size, maxItemsOnScreen()); i++) {
-    yPos += menuLineHeight;
-    if (first + i == index) {
-      int16_t x1, y1;
-      uint16_t w, h;
-      Watchy::display.getTextBounds(items[first + i].name, 0, yPos, &x1, &y1,
-                                    &w, &h);
-      display.fillRect(0, y1 - (menuLineHeight - h) / 2, DISPLAY_WIDTH,
-                       menuLineHeight, fgColor);
-      display.setTextColor(bgColor);
-    } else {
-      display.setTextColor(fgColor);
-    }
-    display.setCursor(0, yPos);
-    display.println(items[first + i].name);
-    const uint8_t triangleWidth = 19;
-    const uint8_t trianglePad = 5;
-    const uint8_t triangleHeight = (triangleWidth*866+500)/1000; // sqrt(triangleWidth^2-(triangleWidth/2)^2)
-    if (first > 0) {
-      // draw scroll up arrow
-      const uint16_t color = (first == index ? bgColor : fgColor);
-      Watchy::display.fillTriangle(
-          DISPLAY_WIDTH - triangleWidth - trianglePad, triangleHeight + trianglePad, 
-          DISPLAY_WIDTH - trianglePad, triangleHeight + trianglePad,
-          DISPLAY_WIDTH - triangleWidth / 2 - trianglePad, trianglePad,
-          color);
+  const uint8_t rows = min(size, uint16_t(maxItemsOnScreen()));
+  if ((Watchy::drawnScreen() == this) && (state.drawnFirst == first)) {
+    // same rows on the screen, only the highlight moved
+    const int16_t drawnIndex = state.drawnIndex;
+    if (drawnIndex != index) {
+      drawRow(drawnIndex - first);
+      drawRow(index - first);
+      const uint8_t last = rows - 1;
+      drawArrows(drawnIndex - first == 0 || index - first == 0,
+                 drawnIndex - first == last || index - first == last);
     }
-    if (first < size - maxItemsOnScreen()) {
-      // draw scroll down arrow
-      const uint16_t color =
-          (first + maxItemsOnScreen() - 1 == index ? bgColor : fgColor);
-      Watchy::display.fillTriangle(
-          DISPLAY_WIDTH - triangleWidth - trianglePad, DISPLAY_HEIGHT - triangleHeight - trianglePad, 
-          DISPLAY_WIDTH - trianglePad, DISPLAY_HEIGHT - triangleHeight - trianglePad,
-          DISPLAY_WIDTH - triangleWidth / 2 - trianglePad, DISPLAY_HEIGHT - trianglePad,
-          color);
+  } else {
+    Watchy::display.fillScreen(bgColor);
+    for (uint8_t i = 0; i < rows; i++) {
+      drawRow(i);
     }
+    drawArrows(true, true);
   }
+  state.drawnFirst = first;
+  state.drawnIndex = index;
 }
 
-void MenuScreen::menu() { Watchy::setScreen(items[index].screen); }
+// every row is the same height, with the ink of any text in the font centered
+// in it, so that a row can be drawn again without touching its neighbours
+void MenuScreen::drawRow(uint8_t row) const {
+  const uint16_t fgColor = (bgColor == GxEPD_WHITE ? GxEPD_BLACK : GxEPD_WHITE);
+  const uint16_t menuLineHeight = font->yAdvance * 15 / 10; // 50% padding
+  const int16_t yPos = (row + 1) * menuLineHeight;
+  const TextBounds b = fontBounds(font);
+  const int16_t first = state.first;
+  const bool highlighted = (first + row == state.index);
+  display.fillRect(0, yPos + b.y1 - (menuLineHeight - b.h) / 2, DISPLAY_WIDTH,
+                   menuLineHeight, highlighted ? fgColor : bgColor);
+  display.setTextColor(highlighted ? bgColor : fgColor);
+  display.setTextWrap(false);  // clip names too long for the row
+  display.setCursor(0, yPos);
+  display.print(name(first + row));
+}
+
+// the scroll arrows are on top of the first and last rows, in the opposite
+// color when that row is highlighted
+void MenuScreen::drawArrows(bool up, bool down) const {
+  const uint16_t fgColor = (bgColor == GxEPD_WHITE ? GxEPD_BLACK : GxEPD_WHITE);
+  const uint8_t triangleWidth = 19;
+  const uint8_t trianglePad = 5;
+  const uint8_t triangleHeight = (triangleWidth*866+500)/1000; // sqrt(triangleWidth^2-(triangleWidth/2)^2)
+  const int16_t first = state.first, index = state.index;
+  if (up && (first > 0)) {
+    // draw scroll up arrow
+    const uint16_t color = (first == index ? bgColor : fgColor);
+    Watchy::display.fillTriangle(
+        DISPLAY_WIDTH - triangleWidth - trianglePad, triangleHeight + trianglePad, 
+        DISPLAY_WIDTH - trianglePad, triangleHeight + trianglePad,
+        DISPLAY_WIDTH - triangleWidth / 2 - trianglePad, trianglePad,
+        color);
+  }
+  if (down && (first < size - maxItemsOnScreen())) {
+    // draw scroll down arrow
+    const uint16_t color =
+        (first + maxItemsOnScreen() - 1 == index ? bgColor : fgColor);
+    Watchy::display.fillTriangle(
+        DISPLAY_WIDTH - triangleWidth - trianglePad, DISPLAY_HEIGHT - triangleHeight - trianglePad, 
+        DISPLAY_WIDTH - trianglePad, DISPLAY_HEIGHT - triangleHeight - trianglePad,
+        DISPLAY_WIDTH - triangleWidth / 2 - trianglePad, DISPLAY_HEIGHT - trianglePad,
+        color);
+  }
+}
+
+void MenuScreen::menu() {
+  if (items) {
+    Watchy::setScreen(items[state.index].screen);
+  } else {
+    Watchy::setScreen(itemSelected(state.index));
+    markDirty();  // in case it changed what the menu shows
+  }
+}
 
 void MenuScreen::back() { setScreen(parent); }
 
-void MenuScreen::up() {
-  index--;
-  if (index < 0) {
-    index = 0;
+void MenuScreen::up() { move(-1); }
+
+void MenuScreen::down() { move(1); }
+
+void MenuScreen::upRepeat(uint16_t n) { move(-1, false); }
+
+void MenuScreen::downRepeat(uint16_t n) { move(1, false); }
+
+void MenuScreen::move(int16_t step, bool doubling) {
+  int16_t &first = state.first, &index = state.index;
+  const int16_t rows = maxItemsOnScreen();
+  const int16_t edge = (step < 0 ? first : first + rows - 1);
+  if ((size > 3 * rows) && (index == edge)) {
+    // off the edge, jump a page. Twice as far as last time if the last move
+    // was a jump the same way.
+    if (!doubling || (state.jump == 0) || ((state.jump < 0) != (step < 0))) {
+      state.jump = step * rows;
+    } else if (abs(state.jump) < size) {
+      state.jump *= 2;
+    }
+    step = state.jump;
+  } else {
+    state.jump = 0;
   }
+  index = max(0, min(index + step, size - 1));
   if (index < first) {
     first = index;
   }
-  showWatchFace(true);
-}
-
-void MenuScreen::down() {
-  index++;
-  if (index >= size) {
-    index = size - 1;
-  }
-  if (index >= first + maxItemsOnScreen()) {
-    first = index - maxItemsOnScreen() + 1;
+  if (index >= first + rows) {
+    first = index - rows + 1;
   }
-  showWatchFace(true);
+  markDirty();
 }
 
 uint8_t MenuScreen::maxItemsOnScreen() const {
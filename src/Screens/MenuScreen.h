@@ -9,22 +9,62 @@ typedef struct {
   Screen *screen;
 } MenuItem;
 
+// for menus with too many items to keep in an array of MenuItems. Gets the
+// name of item i, which only has to last until the next call.
+typedef const char *(*MenuItemName)(uint16_t i);
+// called when item i is selected. Returns the screen to go to, or nullptr to
+// stay on the menu.
+typedef Screen *(*MenuItemSelected)(uint16_t i);
+
 class MenuScreen : public Screen {
  private:
-  const MenuItem *items;  // array of MenuItems
-  const uint8_t size;     // number of MenuItems
-  static int8_t first;    // first MenuItem being displayed
-  static int8_t index;    // currently highlighted MenuItem
+  // kept in RTC memory, one for each menu. Menus are global, so they are
+  // constructed in the same order and get the same one on every wake.
+  typedef struct {
+    int16_t first;  // first item being displayed
+    int16_t index;  // currently highlighted item
+    // first and index as they are in the frame buffer, so moving the
+    // highlight only redraws the two rows it moved between
+    int16_t drawnFirst;
+    int16_t drawnIndex;
+    int16_t jump;  // items moved by the last page jump, 0 if it wasn't one
+  } State;
+  static const uint8_t MAX_MENUS = 4;
+  static State states[MAX_MENUS];
+  static uint8_t numMenus;
+
+  State &state;
+  const MenuItem *items;  // array of MenuItems, or nullptr
+  const MenuItemName itemName;
+  const MenuItemSelected itemSelected;
+  const uint16_t size;  // number of items
   const GFXfont *font;
 
+  const char *name(uint16_t i) const;
+  void drawRow(uint8_t row) const;
+  void drawArrows(bool up, bool down) const;
+  void move(int16_t step, bool doubling = true);
+
  public:
-  MenuScreen(MenuItem *mis, const int8_t ms,
+  MenuScreen(MenuItem *mis, const uint16_t ms,
+             const GFXfont *font = OptimaLTStd12pt7b,
+             uint16_t bg = GxEPD_WHITE);
+  // only the visible rows are ever asked for, so a menu can have hundreds of
+  // items without keeping them all in memory
+  MenuScreen(MenuItemName n, MenuItemSelected s, const uint16_t ms,
              const GFXfont *font = OptimaLTStd12pt7b,
              uint16_t bg = GxEPD_WHITE);
   void show() override;
   void menu() override;
   void back() override;
+  // up and down move the highlight one item. In a menu of more than three
+  // pages, moving off the top or bottom row jumps a whole page instead, and
+  // each further jump in the same direction is twice as far. Held down they
+  // keep moving, a page at a time at the top or bottom row, and it's the
+  // repeats that speed up instead of the jumps.
   void up() override;
   void down() override;
+  void upRepeat(uint16_t n) override;
+  void downRepeat(uint16_t n) override;
   uint8_t maxItemsOnScreen() const;
-};
\ No newline at end of file
+};
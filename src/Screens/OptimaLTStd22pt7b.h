@@ -1,2 +1,99 @@
+// generated by tools/fontsubset.py from tools/fonts/OptimaLTStd22pt7b.h, do not edit
+#pragma once
+
 #include <Adafruit_GFX.h>
 extern const GFXfont *OptimaLTStd22pt7b;
+
+// the glyphs are in the header so that text can be measured at compile time,
+// see textBounds() in GFXTextUtil.h
+constexpr GFXglyph OptimaLTStd22pt7bGlyphs[] = {
+  {     0,   1,   1,  12,    0,    0 },   // 0x20 ' '
+  {     0,   0,   0,   0,    0,    0 },   // 0x21 '!'
+  {     0,   0,   0,   0,    0,    0 },   // 0x22 '"'
+  {     0,   0,   0,   0,    0,    0 },   // 0x23 '#'
+  {     0,   0,   0,   0,    0,    0 },   // 0x24 '$'
+  {     0,   0,   0,   0,    0,    0 },   // 0x25 '%'
+  {     0,   0,   0,   0,    0,    0 },   // 0x26 '&'
+  {     0,   0,   0,   0,    0,    0 },   // 0x27 '''
+  {     0,   0,   0,   0,    0,    0 },   // 0x28 '('
+  {     0,   0,   0,   0,    0,    0 },   // 0x29 ')'
+  {     0,   0,   0,   0,    0,    0 },   // 0x2A '*'
+  {     0,   0,   0,   0,    0,    0 },   // 0x2B '+'
+  {     0,   0,   0,   0,    0,    0 },   // 0x2C ','
+  {     0,   0,   0,   0,    0,    0 },   // 0x2D '-'
+  {     0,   0,   0,   0,    0,    0 },   // 0x2E '.'
+  {     0,   0,   0,   0,    0,    0 },   // 0x2F '/'
+  {     1,  20,  30,  24,    2,  -28 },   // 0x30 '0'
+  {    76,  10,  29,  24,    4,  -28 },   // 0x31 '1'
+  {   113,  18,  29,  24,    1,  -28 },   // 0x32 '2'
+  {   179,  17,  30,  24,    2,  -28 },   // 0x33 '3'
+  {   243,  21,  29,  24,    1,  -28 },   // 0x34 '4'
+  {   320,  18,  30,  24,    2,  -28 },   // 0x35 '5'
+  {   388,  19,  30,  24,    3,  -28 },   // 0x36 '6'
+  {   460,  19,  29,  24,    3,  -28 },   // 0x37 '7'
+  {   529,  20,  30,  24,    2,  -28 },   // 0x38 '8'
+  {   604,  19,  30,  24,    2,  -28 },   // 0x39 '9'
+  {     0,   0,   0,   0,    0,    0 },   // 0x3A ':'
+  {     0,   0,   0,   0,    0,    0 },   // 0x3B ';'
+  {     0,   0,   0,   0,    0,    0 },   // 0x3C '<'
+  {     0,   0,   0,   0,    0,    0 },   // 0x3D '='
+  {     0,   0,   0,   0,    0,    0 },   // 0x3E '>'
+  {     0,   0,   0,   0,    0,    0 },   // 0x3F '?'
+  {     0,   0,   0,   0,    0,    0 },   // 0x40 '@'
+  {     0,   0,   0,   0,    0,    0 },   // 0x41 'A'
+  {     0,   0,   0,   0,    0,    0 },   // 0x42 'B'
+  {     0,   0,   0,   0,    0,    0 },   // 0x43 'C'
+  {     0,   0,   0,   0,    0,    0 },   // 0x44 'D'
+  {     0,   0,   0,   0,    0,    0 },   // 0x45 'E'
+  {     0,   0,   0,   0,    0,    0 },   // 0x46 'F'
+  {     0,   0,   0,   0,    0,    0 },   // 0x47 'G'
+  {     0,   0,   0,   0,    0,    0 },   // 0x48 'H'
+  {     0,   0,   0,   0,    0,    0 },   // 0x49 'I'
+  {     0,   0,   0,   0,    0,    0 },   // 0x4A 'J'
+  {     0,   0,   0,   0,    0,    0 },   // 0x4B 'K'
+  {     0,   0,   0,   0,    0,    0 },   // 0x4C 'L'
+  {     0,   0,   0,   0,    0,    0 },   // 0x4D 'M'
+  {     0,   0,   0,   0,    0,    0 },   // 0x4E 'N'
+  {     0,   0,   0,   0,    0,    0 },   // 0x4F 'O'
+  {     0,   0,   0,   0,    0,    0 },   // 0x50 'P'
+  {     0,   0,   0,   0,    0,    0 },   // 0x51 'Q'
+  {     0,   0,   0,   0,    0,    0 },   // 0x52 'R'
+  {     0,   0,   0,   0,    0,    0 },   // 0x53 'S'
+  {     0,   0,   0,   0,    0,    0 },   // 0x54 'T'
+  {     0,   0,   0,   0,    0,    0 },   // 0x55 'U'
+  {     0,   0,   0,   0,    0,    0 },   // 0x56 'V'
+  {     0,   0,   0,   0,    0,    0 },   // 0x57 'W'
+  {     0,   0,   0,   0,    0,    0 },   // 0x58 'X'
+  {     0,   0,   0,   0,    0,    0 },   // 0x59 'Y'
+  {     0,   0,   0,   0,    0,    0 },   // 0x5A 'Z'
+  {     0,   0,   0,   0,    0,    0 },   // 0x5B '['
+  {     0,   0,   0,   0,    0,    0 },   // 0x5C '\'
+  {     0,   0,   0,   0,    0,    0 },   // 0x5D ']'
+  {     0,   0,   0,   0,    0,    0 },   // 0x5E '^'
+  {     0,   0,   0,   0,    0,    0 },   // 0x5F '_'
+  {     0,   0,   0,   0,    0,    0 },   // 0x60 '`'
+  {   676,  18,  22,  22,    2,  -20 },   // 0x61 'a'
+  {   726,  20,  33,  24,    2,  -31 },   // 0x62 'b'
+  {     0,   0,   0,   0,    0,    0 },   // 0x63 'c'
+  {     0,   0,   0,   0,    0,    0 },   // 0x64 'd'
+  {   809,  19,  22,  22,    1,  -20 },   // 0x65 'e'
+  {   862,  12,  33,  12,    1,  -32 },   // 0x66 'f'
+  {   912,  20,  33,  22,    1,  -20 },   // 0x67 'g'
+  {   995,  18,  32,  24,    3,  -31 },   // 0x68 'h'
+  {  1067,   4,  30,  12,    4,  -29 },   // 0x69 'i'
+  {     0,   0,   0,   0,    0,    0 },   // 0x6A 'j'
+  {     0,   0,   0,   0,    0,    0 },   // 0x6B 'k'
+  {  1082,   4,  32,  12,    4,  -31 },   // 0x6C 'l'
+  {     0,   0,   0,   0,    0,    0 },   // 0x6D 'm'
+  {  1098,  18,  21,  24,    3,  -20 },   // 0x6E 'n'
+  {  1146,  21,  22,  24,    1,  -20 },   // 0x6F 'o'
+  {  1204,  20,  33,  24,    2,  -20 },   // 0x70 'p'
+  {     0,   0,   0,   0,    0,    0 },   // 0x71 'q'
+  {  1287,  11,  21,  14,    3,  -20 },   // 0x72 'r'
+  {  1316,  13,  22,  17,    2,  -20 },   // 0x73 's'
+  {  1352,  11,  27,  12,    1,  -25 },   // 0x74 't'
+  {  1390,  18,  21,  24,    3,  -19 },   // 0x75 'u'
+  {     0,   0,   0,   0,    0,    0 },   // 0x76 'v'
+  {  1438,  32,  20,  34,    1,  -19 },   // 0x77 'w'
+  {  1518,  19,  20,  22,    1,  -19 },   // 0x78 'x'
+  {  1566,  20,  32,  22,    1,  -19 } }; // 0x79 'y'
@@ -1,3 +1,4 @@
+// generated by tools/fontsubset.py from tools/fonts/OptimaLTStd_Black32pt7b.cpp, do not edit
 #include <Adafruit_GFX.h>
 
 const uint8_t OptimaLTStd_Black32pt7bBitmaps[] PROGMEM = {
@@ -135,159 +136,7 @@ const uint8_t OptimaLTStd_Black32pt7bBitmaps[] PROGMEM = {
   0xE0, 0x00, 0x00, 0x1F, 0x07, 0xF1, 0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
   0xFF, 0xFF, 0x7F, 0xCF, 0xF0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0xFF, 0x1F, 0xF7, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFC, 0x7F, 0x07, 0xC0, 0x00, 0x1F,
-  0xF0, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x3F, 0xFF, 0xF0, 0x01, 0xFE, 0x1F,
-  0xE0, 0x0F, 0xF0, 0x3F, 0xC0, 0x7F, 0x80, 0x7F, 0x83, 0xFE, 0x01, 0xFF,
-  0x0F, 0xF8, 0x07, 0xFC, 0x7F, 0xC0, 0x1F, 0xF9, 0xFF, 0x00, 0x7F, 0xEF,
-  0xFC, 0x00, 0xFF, 0xBF, 0xF0, 0x03, 0xFE, 0xFF, 0xC0, 0x0F, 0xFB, 0xFF,
-  0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
-  0xFF, 0xFB, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-  0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00,
-  0x1F, 0xF8, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x10, 0xFF, 0xC0, 0x00, 0xC3,
-  0xFF, 0xC0, 0x0F, 0x07, 0xFF, 0xC0, 0xFC, 0x0F, 0xFF, 0xFF, 0xE0, 0x1F,
-  0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x1F,
-  0xF8, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x7F, 0x80, 0x07, 0xFC, 0x00, 0x7F,
-  0xE0, 0x07, 0xFF, 0x00, 0x7F, 0xF8, 0x07, 0xFF, 0xC0, 0x3E, 0x1E, 0x03,
-  0xE0, 0x10, 0x1E, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0xC0, 0x00, 0x7E, 0x00,
-  0x03, 0xF8, 0x00, 0x3F, 0xC0, 0x01, 0xFF, 0x00, 0xFF, 0xFF, 0xE7, 0xFF,
-  0xFF, 0x1F, 0xFF, 0xF9, 0xFF, 0xFF, 0xC0, 0xFF, 0xC0, 0x07, 0xFE, 0x00,
-  0x3F, 0xF0, 0x01, 0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x7F, 0xE0, 0x03, 0xFF,
-  0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x01,
-  0xFF, 0x80, 0x0F, 0xFC, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x1F, 0xF8,
-  0x00, 0xFF, 0xC0, 0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0x80, 0x0F,
-  0xFC, 0x00, 0x7F, 0xE0, 0x03, 0xFF, 0x00, 0x1F, 0xF8, 0x00, 0xFF, 0xC0,
-  0x07, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x7F, 0xF8, 0x00, 0x07, 0xFF,
-  0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xF8, 0xFF, 0x87, 0xFF, 0xF3, 0xFE, 0x07,
-  0xFC, 0x07, 0xFC, 0x07, 0xFC, 0x1F, 0xF8, 0x0F, 0xF8, 0x3F, 0xE0, 0x1F,
-  0xF0, 0x7F, 0xC0, 0x3F, 0xF0, 0xFF, 0x80, 0x7F, 0xE1, 0xFF, 0x00, 0xFF,
-  0xC3, 0xFE, 0x01, 0xFF, 0x87, 0xFC, 0x03, 0xFF, 0x0F, 0xF8, 0x07, 0xFC,
-  0x1F, 0xF0, 0x0F, 0xF8, 0x1F, 0xF0, 0x1F, 0xE0, 0x1F, 0xE0, 0x7F, 0xC0,
-  0x1F, 0xE1, 0xFF, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xC0, 0x00,
-  0x0E, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F,
-  0xC0, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xFF,
-  0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0x83, 0xFF,
-  0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0x03, 0xFF,
-  0xFF, 0xFE, 0x1F, 0x00, 0x1F, 0xFC, 0xFC, 0x00, 0x0F, 0xFB, 0xF0, 0x00,
-  0x0F, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0x00, 0x00,
-  0x3F, 0xFE, 0x00, 0x00, 0x7E, 0xFC, 0x00, 0x01, 0xFD, 0xFC, 0x00, 0x03,
-  0xF3, 0xF8, 0x00, 0x0F, 0xE3, 0xF8, 0x00, 0x3F, 0x87, 0xFC, 0x00, 0xFE,
-  0x07, 0xFF, 0x1F, 0xF8, 0x07, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFE, 0x00,
-  0x00, 0xFF, 0xC0, 0x00, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F,
-  0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF,
-  0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0xFF, 0xC0,
-  0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x3F, 0xF0, 0x00,
-  0x00, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0xFC, 0x0F, 0xE0,
-  0x3F, 0xF0, 0xFF, 0xF0, 0xFF, 0xCF, 0xFF, 0xE3, 0xFF, 0x7F, 0xFF, 0xCF,
-  0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFE, 0xFF, 0xF8, 0x3F, 0xFB, 0xFF,
-  0xC0, 0x7F, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xC0,
-  0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x03,
-  0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xFF,
-  0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF,
-  0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF,
-  0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0,
-  0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x03,
-  0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x7F, 0xF0, 0x1F, 0x07, 0xF1,
-  0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFE, 0x7F, 0xC3, 0xF0, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEF, 0xFD, 0xFF, 0xBF,
-  0xF7, 0xFE, 0xFF, 0xDF, 0xF3, 0xFE, 0x7F, 0xCF, 0xF9, 0xFF, 0x3F, 0xE7,
-  0xFC, 0xFF, 0x9F, 0xF3, 0xFE, 0x7F, 0xCF, 0xF9, 0xFF, 0x3F, 0xE7, 0xFC,
-  0xFF, 0xDF, 0xFB, 0xFF, 0x7F, 0xEF, 0xFD, 0xFF, 0xBF, 0xF7, 0xFE, 0xFF,
-  0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xF7, 0xFE, 0xFF, 0xDF, 0xFB,
-  0xFF, 0x7F, 0xEF, 0xFD, 0xFF, 0xBF, 0xF7, 0xFE, 0xFF, 0xDF, 0xFB, 0xFF,
-  0x7F, 0xEF, 0xFD, 0xFF, 0xBF, 0xF7, 0xFE, 0xFF, 0xDF, 0xFB, 0xFF, 0x7F,
-  0xEF, 0xFD, 0xFF, 0xBF, 0xF7, 0xFE, 0xFF, 0xDF, 0xFB, 0xFF, 0x7F, 0xEF,
-  0xFD, 0xFF, 0xBF, 0xF7, 0xFE, 0xFF, 0xDF, 0xFB, 0xFF, 0x7F, 0xEF, 0xFD,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFE, 0x03, 0xFF, 0x0F,
-  0xFF, 0x0F, 0xFC, 0xFF, 0xFE, 0x3F, 0xF7, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF,
-  0xFB, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xEF, 0xFF, 0xBF, 0xFC, 0x0F, 0xFF,
-  0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFE, 0x00, 0xFF, 0xFF,
-  0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFC,
-  0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00,
-  0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x0F,
-  0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF,
-  0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0xFF, 0xFF,
-  0xF0, 0x03, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xFC,
-  0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x1F,
-  0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x0F, 0xF8, 0x7F, 0xE0, 0x07,
-  0xFC, 0x07, 0xFC, 0x03, 0xFE, 0x01, 0xFF, 0x81, 0xFF, 0x00, 0x3F, 0xE0,
-  0x7F, 0xC0, 0x0F, 0xFC, 0x3F, 0xF0, 0x01, 0xFF, 0x0F, 0xF8, 0x00, 0x7F,
-  0xE7, 0xFE, 0x00, 0x1F, 0xF9, 0xFF, 0x80, 0x07, 0xFE, 0x7F, 0xE0, 0x01,
-  0xFF, 0xDF, 0xF8, 0x00, 0x7F, 0xF7, 0xFE, 0x00, 0x1F, 0xFD, 0xFF, 0x80,
-  0x07, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xF7, 0xFE,
-  0x00, 0x1F, 0xFD, 0xFF, 0x80, 0x07, 0xFF, 0x7F, 0xE0, 0x01, 0xFF, 0x9F,
-  0xF8, 0x00, 0x7F, 0xE7, 0xFE, 0x00, 0x1F, 0xF8, 0xFF, 0x80, 0x07, 0xFC,
-  0x3F, 0xF0, 0x03, 0xFF, 0x07, 0xFC, 0x00, 0xFF, 0x81, 0xFF, 0x00, 0x3F,
-  0xE0, 0x3F, 0xE0, 0x1F, 0xF0, 0x07, 0xFC, 0x0F, 0xF8, 0x00, 0xFF, 0x87,
-  0xFC, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x0F,
-  0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0xFF, 0xFF, 0x3F, 0xFF, 0xEF,
-  0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xBF, 0xFF, 0xC1, 0x7F, 0xF0, 0x0F, 0xFE, 0x01, 0xFF, 0x80,
-  0x3F, 0xF0, 0x07, 0xFE, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x03, 0xFF, 0x00,
-  0x7F, 0xE0, 0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x3F, 0xF0, 0x07, 0xFE, 0x00,
-  0xFF, 0xC0, 0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x01,
-  0xFF, 0x80, 0x3F, 0xF8, 0x07, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x1F, 0xFF,
-  0x81, 0xFF, 0xFF, 0x8F, 0xFF, 0xFE, 0x7F, 0x01, 0xF1, 0xF8, 0x01, 0xCF,
-  0xE0, 0x07, 0x3F, 0x80, 0x0C, 0xFE, 0x00, 0x23, 0xFC, 0x00, 0x0F, 0xF8,
-  0x00, 0x3F, 0xFC, 0x00, 0xFF, 0xFE, 0x03, 0xFF, 0xFE, 0x0F, 0xFF, 0xFE,
-  0x1F, 0xFF, 0xFC, 0x7F, 0xFF, 0xF8, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xC1,
-  0xFF, 0xFF, 0x01, 0xFF, 0xFC, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0xC0, 0x00,
-  0xFF, 0x40, 0x01, 0xFD, 0x80, 0x07, 0xFE, 0x00, 0x1F, 0xBC, 0x00, 0xFE,
-  0xF8, 0x03, 0xF3, 0xFE, 0xFF, 0x8F, 0xFF, 0xFC, 0x1F, 0xFF, 0xE0, 0x07,
-  0xFC, 0x00, 0x00, 0x0C, 0x00, 0x07, 0x80, 0x03, 0xF0, 0x01, 0xFE, 0x00,
-  0xFF, 0xC0, 0x1F, 0xF8, 0x03, 0xFF, 0x00, 0x7F, 0xE0, 0x0F, 0xFC, 0x01,
-  0xFF, 0x80, 0x3F, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xF8, 0x7F, 0xE0, 0x0F, 0xFC, 0x01, 0xFF, 0x80, 0x3F, 0xF0, 0x07,
-  0xFE, 0x00, 0xFF, 0x80, 0x1F, 0xF0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x0F,
-  0xF8, 0x01, 0xFF, 0x00, 0x3F, 0xE0, 0x07, 0xFC, 0x00, 0xFF, 0x80, 0x1F,
-  0xF0, 0x03, 0xFE, 0x00, 0x7F, 0xC0, 0x0F, 0xF8, 0x01, 0xFF, 0x00, 0x3F,
-  0xE0, 0x07, 0xFC, 0x00, 0xFF, 0xC0, 0x1F, 0xF8, 0x03, 0xFF, 0x80, 0x3F,
-  0xFF, 0x03, 0xFF, 0xE0, 0x3F, 0xFC, 0x01, 0xFC, 0x00, 0xFF, 0xE0, 0x0F,
-  0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFE, 0x00, 0xFF, 0xDF, 0xF8, 0x03, 0xFF,
-  0x7F, 0xE0, 0x0F, 0xFD, 0xFF, 0x80, 0x3F, 0xF7, 0xFE, 0x00, 0xFF, 0xDF,
-  0xF8, 0x03, 0xFF, 0x7F, 0xE0, 0x0F, 0xFD, 0xFF, 0x80, 0x3F, 0xF7, 0xFE,
-  0x00, 0xFF, 0x9F, 0xF8, 0x03, 0xFE, 0x7F, 0xE0, 0x0F, 0xF9, 0xFF, 0x80,
-  0x3F, 0xE7, 0xFE, 0x00, 0xFF, 0x9F, 0xF8, 0x03, 0xFE, 0x7F, 0xE0, 0x0F,
-  0xF9, 0xFF, 0x80, 0x3F, 0xE7, 0xFE, 0x00, 0xFF, 0x9F, 0xF8, 0x03, 0xFF,
-  0x7F, 0xE0, 0x0F, 0xFD, 0xFF, 0x80, 0x3F, 0xF7, 0xFE, 0x01, 0xFF, 0xDF,
-  0xF8, 0x07, 0xFF, 0x7F, 0xF0, 0x3F, 0xFD, 0xFF, 0xE1, 0xFF, 0xF3, 0xFF,
-  0xFF, 0xFF, 0xCF, 0xFF, 0xFB, 0xFF, 0x1F, 0xFF, 0xEF, 0xFC, 0x3F, 0xFF,
-  0x3F, 0xF0, 0x7F, 0xF0, 0xFF, 0xC0, 0x7F, 0x00, 0x00, 0x7F, 0xF0, 0x00,
-  0x7E, 0x7F, 0xF0, 0x00, 0xFE, 0x7F, 0xF8, 0x00, 0xFC, 0x3F, 0xF8, 0x00,
-  0xFC, 0x3F, 0xF8, 0x00, 0xF8, 0x1F, 0xF8, 0x01, 0xF8, 0x1F, 0xFC, 0x01,
-  0xF0, 0x1F, 0xFC, 0x01, 0xF0, 0x0F, 0xFC, 0x03, 0xF0, 0x0F, 0xFE, 0x03,
-  0xE0, 0x07, 0xFE, 0x03, 0xE0, 0x07, 0xFE, 0x07, 0xE0, 0x07, 0xFE, 0x07,
-  0xC0, 0x03, 0xFF, 0x07, 0xC0, 0x03, 0xFF, 0x0F, 0x80, 0x03, 0xFF, 0x0F,
-  0x80, 0x01, 0xFF, 0x8F, 0x80, 0x01, 0xFF, 0x9F, 0x00, 0x01, 0xFF, 0x9F,
-  0x00, 0x00, 0xFF, 0xDF, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFE,
-  0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x7F, 0xFC,
-  0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0xF8,
-  0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0xF0,
-  0x00, 0xFF, 0xF0, 0x03, 0xFE, 0x00, 0x3F, 0xBF, 0xF8, 0x01, 0xFF, 0x80,
-  0x1F, 0x9F, 0xFC, 0x00, 0xFF, 0xC0, 0x0F, 0xCF, 0xFE, 0x00, 0x7F, 0xE0,
-  0x0F, 0xC3, 0xFF, 0x00, 0x7F, 0xF0, 0x07, 0xE1, 0xFF, 0xC0, 0x3F, 0xFC,
-  0x03, 0xF0, 0xFF, 0xE0, 0x1F, 0xFE, 0x01, 0xF0, 0x3F, 0xF0, 0x1F, 0xFF,
-  0x01, 0xF8, 0x1F, 0xF8, 0x0F, 0xFF, 0x80, 0xF8, 0x0F, 0xFE, 0x07, 0xFF,
-  0xE0, 0x7C, 0x03, 0xFF, 0x03, 0xFF, 0xF0, 0x3E, 0x01, 0xFF, 0x83, 0xFF,
-  0xF8, 0x3E, 0x00, 0xFF, 0xC1, 0xFF, 0xFC, 0x1F, 0x00, 0x3F, 0xF0, 0xF3,
-  0xFF, 0x0F, 0x80, 0x1F, 0xF8, 0xF9, 0xFF, 0x87, 0x80, 0x0F, 0xFC, 0x7C,
-  0xFF, 0xC7, 0xC0, 0x03, 0xFE, 0x3C, 0x3F, 0xF3, 0xC0, 0x01, 0xFF, 0xBE,
-  0x1F, 0xF9, 0xE0, 0x00, 0xFF, 0xDF, 0x0F, 0xFD, 0xF0, 0x00, 0x3F, 0xEF,
-  0x03, 0xFE, 0xF0, 0x00, 0x1F, 0xFF, 0x81, 0xFF, 0xF8, 0x00, 0x0F, 0xFF,
-  0xC0, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xE0, 0x7F, 0xFC, 0x00, 0x01, 0xFF,
-  0xE0, 0x1F, 0xFE, 0x00, 0x00, 0xFF, 0xF0, 0x0F, 0xFF, 0x00, 0x00, 0x7F,
-  0xF8, 0x07, 0xFF, 0x00, 0x00, 0x1F, 0xF8, 0x01, 0xFF, 0x80, 0x00, 0x0F,
-  0xFC, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xFE, 0x00, 0x7F, 0xC0, 0x00, 0x03,
-  0xFF, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF,
-  0xF0, 0x03, 0xF9, 0xFF, 0xE0, 0x1F, 0xC3, 0xFF, 0x80, 0x7E, 0x0F, 0xFF,
-  0x03, 0xF8, 0x1F, 0xFC, 0x0F, 0xC0, 0x7F, 0xF8, 0x7E, 0x00, 0xFF, 0xE3,
-  0xF0, 0x01, 0xFF, 0xCF, 0x80, 0x07, 0xFF, 0x7E, 0x00, 0x0F, 0xFF, 0xF0,
-  0x00, 0x3F, 0xFF, 0x80, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xFF, 0xF0, 0x00,
-  0x03, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,
-  0x3F, 0xF8, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x3F,
-  0xFF, 0x80, 0x01, 0xFF, 0xFE, 0x00, 0x07, 0xDF, 0xFC, 0x00, 0x3F, 0x7F,
-  0xF0, 0x01, 0xF8, 0xFF, 0xE0, 0x07, 0xC3, 0xFF, 0xC0, 0x3F, 0x07, 0xFF,
-  0x01, 0xF8, 0x0F, 0xFE, 0x0F, 0xE0, 0x3F, 0xFC, 0x7F, 0x00, 0x7F, 0xF1,
-  0xFC, 0x01, 0xFF, 0xEF, 0xE0, 0x07, 0xFF, 0x80 };
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFC, 0x7F, 0x07, 0xC0 };
 
 const GFXglyph OptimaLTStd_Black32pt7bGlyphs[] PROGMEM = {
   {     0,  29,  45,  31,    1,  -43 },   // 0x30 '0'
@@ -300,76 +149,14 @@ const GFXglyph OptimaLTStd_Black32pt7bGlyphs[] PROGMEM = {
   {  1085,  30,  43,  31,    3,  -42 },   // 0x37 '7'
   {  1247,  29,  45,  31,    1,  -43 },   // 0x38 '8'
   {  1411,  29,  45,  31,    1,  -43 },   // 0x39 '9'
-  {  1575,  11,  31,  28,    8,  -29 },   // 0x3A ':'
-  {     0,   0,   0,   0,    0,    0 },   // 0x3B ';'
-  {     0,   0,   0,   0,    0,    0 },   // 0x3C '<'
-  {     0,   0,   0,   0,    0,    0 },   // 0x3D '='
-  {     0,   0,   0,   0,    0,    0 },   // 0x3E '>'
-  {     0,   0,   0,   0,    0,    0 },   // 0x3F '?'
-  {     0,   0,   0,   0,    0,    0 },   // 0x40 '@'
-  {     0,   0,   0,   0,    0,    0 },   // 0x41 'A'
-  {     0,   0,   0,   0,    0,    0 },   // 0x42 'B'
-  {     0,   0,   0,   0,    0,    0 },   // 0x43 'C'
-  {     0,   0,   0,   0,    0,    0 },   // 0x44 'D'
-  {     0,   0,   0,   0,    0,    0 },   // 0x45 'E'
-  {     0,   0,   0,   0,    0,    0 },   // 0x46 'F'
-  {     0,   0,   0,   0,    0,    0 },   // 0x47 'G'
-  {     0,   0,   0,   0,    0,    0 },   // 0x48 'H'
-  {     0,   0,   0,   0,    0,    0 },   // 0x49 'I'
-  {     0,   0,   0,   0,    0,    0 },   // 0x4A 'J'
-  {     0,   0,   0,   0,    0,    0 },   // 0x4B 'K'
-  {     0,   0,   0,   0,    0,    0 },   // 0x4C 'L'
-  {     0,   0,   0,   0,    0,    0 },   // 0x4D 'M'
-  {     0,   0,   0,   0,    0,    0 },   // 0x4E 'N'
-  {     0,   0,   0,   0,    0,    0 },   // 0x4F 'O'
-  {     0,   0,   0,   0,    0,    0 },   // 0x50 'P'
-  {     0,   0,   0,   0,    0,    0 },   // 0x51 'Q'
-  {     0,   0,   0,   0,    0,    0 },   // 0x52 'R'
-  {     0,   0,   0,   0,    0,    0 },   // 0x53 'S'
-  {     0,   0,   0,   0,    0,    0 },   // 0x54 'T'
-  {     0,   0,   0,   0,    0,    0 },   // 0x55 'U'
-  {     0,   0,   0,   0,    0,    0 },   // 0x56 'V'
-  {     0,   0,   0,   0,    0,    0 },   // 0x57 'W'
-  {     0,   0,   0,   0,    0,    0 },   // 0x58 'X'
-  {     0,   0,   0,   0,    0,    0 },   // 0x59 'Y'
-  {     0,   0,   0,   0,    0,    0 },   // 0x5A 'Z'
-  {     0,   0,   0,   0,    0,    0 },   // 0x5B '['
-  {     0,   0,   0,   0,    0,    0 },   // 0x5C '\'
-  {     0,   0,   0,   0,    0,    0 },   // 0x5D ']'
-  {     0,   0,   0,   0,    0,    0 },   // 0x5E '^'
-  {     0,   0,   0,   0,    0,    0 },   // 0x5F '_'
-  {     0,   0,   0,   0,    0,    0 },   // 0x60 '`'
-  {     0,   0,   0,   0,    0,    0 },   // 0x61 'a'
-  {     0,   0,   0,   0,    0,    0 },   // 0x62 'b'
-  {     0,   0,   0,   0,    0,    0 },   // 0x63 'c'
-  {     0,   0,   0,   0,    0,    0 },   // 0x64 'd'
-  {  1618,  30,  33,  35,    3,  -31 },   // 0x65 'e'
-  {  1742,  21,  47,  21,    1,  -46 },   // 0x66 'f'
-  {  1866,  31,  49,  35,    2,  -31 },   // 0x67 'g'
-  {  2056,  30,  46,  38,    4,  -45 },   // 0x68 'h'
-  {  2229,  11,  47,  17,    3,  -46 },   // 0x69 'i'
-  {     0,   0,   0,   0,    0,    0 },   // 0x6A 'j'
-  {     0,   0,   0,   0,    0,    0 },   // 0x6B 'k'
-  {  2294,  11,  46,  17,    3,  -45 },   // 0x6C 'l'
-  {     0,   0,   0,   0,    0,    0 },   // 0x6D 'm'
-  {  2358,  30,  32,  38,    4,  -31 },   // 0x6E 'n'
-  {  2478,  34,  33,  38,    2,  -31 },   // 0x6F 'o'
-  {     0,   0,   0,   0,    0,    0 },   // 0x70 'p'
-  {     0,   0,   0,   0,    0,    0 },   // 0x71 'q'
-  {  2619,  19,  32,  24,    4,  -31 },   // 0x72 'r'
-  {  2695,  22,  33,  28,    3,  -31 },   // 0x73 's'
-  {  2786,  19,  43,  21,    1,  -41 },   // 0x74 't'
-  {  2889,  30,  32,  38,    4,  -30 },   // 0x75 'u'
-  {  3009,  32,  31,  31,    0,  -30 },   // 0x76 'v'
-  {  3133,  49,  31,  49,    0,  -30 },   // 0x77 'w'
-  {  3323,  30,  31,  31,    1,  -30 } }; // 0x78 'x'
+  {  1575,  11,  31,  28,    8,  -29 } }; // 0x3A ':'
 
 const GFXfont OptimaLTStd_Black32pt7bStruct PROGMEM = {
   (uint8_t  *)OptimaLTStd_Black32pt7bBitmaps,
   (GFXglyph *)OptimaLTStd_Black32pt7bGlyphs,
   // 0x30, 0x78, 75 };
-  0x30, 0x78, 60 };
+  0x30, 0x3A, 60 };
 
 const GFXfont *OptimaLTStd_Black32pt7b = &OptimaLTStd_Black32pt7bStruct;
 
-// Approx. 3958 bytes
+// Approx. 1702 bytes
@@ -1,2 +1,3 @@
+// generated by tools/fontsubset.py from tools/fonts/OptimaLTStd_Black32pt7b.h, do not edit
 #include <Adafruit_GFX.h>
 extern const GFXfont *OptimaLTStd_Black32pt7b;
@@ -23,6 +23,8 @@ typedef struct {
   int16_t SetTimeScreen::*val;
   int16_t min;
   int16_t max;
+  const char *format;
+  int16_t offset;  // added to val when it's printed
 } Field;
 
 void decrMin(int16_t &val, int16_t &min, int16_t &max) {
@@ -37,92 +39,142 @@ void incrMax(int16_t &val, int16_t &min, int16_t &max) {
   }
 }
 
-Field fields[] = {{&SetTimeScreen::hour,   0,  23},
-                  {&SetTimeScreen::minute, 0,  59},
-                  {&SetTimeScreen::year, 120, 199},
-                  {&SetTimeScreen::month,  1,  12},
-                  {&SetTimeScreen::day,    1,  31}};
+Field fields[] = {{&SetTimeScreen::hour,   0,  23, "%2d",     0},
+                  {&SetTimeScreen::minute, 0,  59, "%02d",    0},
+                  {&SetTimeScreen::year, 120, 199, "%d",   1900},
+                  {&SetTimeScreen::month,  0,  11, "%02d",    1},
+                  {&SetTimeScreen::day,    1,  31, "%02d",    0}};
 const uint8_t numFields = sizeof(fields) / sizeof(fields[0]);
 
+// the values being set, taken from the clock when setting starts and kept
+// across deep sleep until they are set or abandoned
+RTC_DATA_ATTR bool setting;
+RTC_DATA_ATTR int16_t settingValues[numFields];
+
+// the screen is drawn as a run of pieces, each either a field or some fixed
+// text. The time is on one line in the big font, then the date.
+const int8_t NO_FIELD = -1;
+typedef struct {
+  int8_t field;      // index into fields, or NO_FIELD
+  const char *text;  // for NO_FIELD
+} Piece;
+
+const Piece pieces[] = {{SET_HOUR, nullptr},  {NO_FIELD, ":"},
+                        {SET_MINUTE, nullptr}, {SET_YEAR, nullptr},
+                        {NO_FIELD, "/"},       {SET_MONTH, nullptr},
+                        {NO_FIELD, "/"},       {SET_DAY, nullptr}};
+const uint8_t numPieces = sizeof(pieces) / sizeof(pieces[0]);
+const uint8_t DATE_PIECE = 3;  // first piece on the date line
+
+// where each piece was drawn, and what was drawn, so that when only the blink
+// changes just the blinking field is drawn again. Kept across deep sleep for
+// frames drawn before going to sleep.
+RTC_DATA_ATTR int16_t pieceX[numPieces];
+RTC_DATA_ATTR int16_t drawnValues[numFields];
+RTC_DATA_ATTR uint8_t drawnIndex;
+
 struct tm tm;
 
+void SetTimeScreen::drawPiece(uint8_t i, uint16_t color) {
+  const Piece &p = pieces[i];
+  if (i < DATE_PIECE) {
+    display.setFont(OptimaLTStd_Black32pt7b);
+    display.setCursor(pieceX[i], 80);
+  } else {
+    display.setFont(OptimaLTStd12pt7b);
+    display.setCursor(pieceX[i], 150);
+  }
+  display.setTextColor(color);
+  if (p.field == NO_FIELD) {
+    display.print(p.text);
+  } else {
+    const Field &f = fields[p.field];
+    display.printf(f.format, this->*(f.val) + f.offset);
+  }
+}
+
 void SetTimeScreen::show() {
-  log_i("blink: %d, setIndex: %d", blink, setIndex);
-  time_t t = now();
-  localtime_r(&t, &tm);
+  Watchy::RTC.setRefresh(RTC_REFRESH_SEC);
+  showAt(now());
+}
 
-  minute = tm.tm_min;
-  hour = tm.tm_hour;
-  day = tm.tm_mday;
-  month = tm.tm_mon;
-  year = tm.tm_year;
+bool SetTimeScreen::showAt(time_t t) {
+  log_i("blink: %d, setIndex: %d", blink, setIndex);
+  if (!setting) {
+    localtime_r(&t, &tm);
+    minute = tm.tm_min;
+    hour = tm.tm_hour;
+    day = tm.tm_mday;
+    month = tm.tm_mon;
+    year = tm.tm_year;
+    for (uint8_t i = 0; i < numFields; i++) {
+      settingValues[i] = this->*(fields[i].val);
+    }
+    setting = true;
+  }
+  for (uint8_t i = 0; i < numFields; i++) {
+    this->*(fields[i].val) = settingValues[i];
+  }
 
   revert = false;
   commit = false;
 
-  Watchy::RTC.setRefresh(RTC_REFRESH_SEC);
-
   blink = 1 - blink;
-  const uint16_t fgColor =
-      (screen->bgColor == GxEPD_WHITE ? GxEPD_BLACK : GxEPD_WHITE);
+  const uint16_t fgColor = (bgColor == GxEPD_WHITE ? GxEPD_BLACK : GxEPD_WHITE);
 
-  display.fillScreen(screen->bgColor);
-  display.setFont(OptimaLTStd_Black32pt7b);
-  display.setTextColor(fgColor);
-
-  display.setCursor(25, 80);
-  if (setIndex == SET_HOUR) {  // blink hour digits
-    display.setTextColor(blink ? fgColor : screen->bgColor);
+  bool unchanged = (Watchy::drawnScreen() == this) && (drawnIndex == setIndex);
+  for (uint8_t i = 0; unchanged && (i < numFields); i++) {
+    unchanged = (drawnValues[i] == this->*(fields[i].val));
   }
-  display.printf("%2d", hour);
-
-  display.setTextColor(fgColor);
-  display.print(":");
-
-  if (setIndex == SET_MINUTE) {  // blink minute digits
-    display.setTextColor(blink ? fgColor : screen->bgColor);
+  if (unchanged) {
+    // only the blink changed. Redraw the blinking field, then the fixed text
+    // on its line in case their glyphs overlap.
+    const uint8_t first = setIndex < SET_YEAR ? 0 : DATE_PIECE;
+    const uint8_t last = setIndex < SET_YEAR ? DATE_PIECE : numPieces;
+    for (uint8_t i = first; i < last; i++) {
+      if (pieces[i].field == setIndex) {
+        drawPiece(i, blink ? fgColor : bgColor);
+      }
+    }
+    for (uint8_t i = first; i < last; i++) {
+      if (pieces[i].field == NO_FIELD) {
+        drawPiece(i, fgColor);
+      }
+    }
+    return true;
   }
-  display.printf("%02d", minute);
 
-  display.setTextColor(fgColor);
-
-  display.setFont(OptimaLTStd12pt7b);
-  display.setCursor(50, 150);
-  if (setIndex == SET_YEAR) {  // blink minute digits
-    display.setTextColor(blink ? fgColor : screen->bgColor);
-  }
-  display.print(year + 1900);
-
-  display.setTextColor(fgColor);
-  display.print("/");
-
-  if (setIndex == SET_MONTH) {  // blink minute digits
-    display.setTextColor(blink ? fgColor : screen->bgColor);
+  display.fillScreen(bgColor);
+  for (uint8_t i = 0; i < numPieces; i++) {
+    if (i == 0) {
+      pieceX[i] = 25;
+    } else if (i == DATE_PIECE) {
+      pieceX[i] = 50;
+    } else {
+      pieceX[i] = display.getCursorX();
+    }
+    // the field being set blinks
+    drawPiece(i, (pieces[i].field == setIndex) && !blink ? bgColor : fgColor);
   }
-  display.printf("%02d", month);
-
-  display.setTextColor(fgColor);
-  display.print("/");
-
-  if (setIndex == SET_DAY) {  // blink minute digits
-    display.setTextColor(blink ? fgColor : screen->bgColor);
+  for (uint8_t i = 0; i < numFields; i++) {
+    drawnValues[i] = this->*(fields[i].val);
   }
-  display.printf("%02d", day);
+  drawnIndex = setIndex;
+  return true;
 }
 
 void SetTimeScreen::up() {
-  decrMin(this->*(fields[setIndex].val), fields[setIndex].min,
-          fields[setIndex].max);
+  decrMin(settingValues[setIndex], fields[setIndex].min, fields[setIndex].max);
 }
 
 void SetTimeScreen::down() {
-  incrMax(this->*(fields[setIndex].val), fields[setIndex].min,
-          fields[setIndex].max);
+  incrMax(settingValues[setIndex], fields[setIndex].min, fields[setIndex].max);
 }
 
 void SetTimeScreen::back() {
   if (setIndex == 0) {
     setIndex = 0;  // make sure we start at the beginning if we come back
+    setting = false;
     Watchy::setScreen(parent);
   } else {
     setIndex--;
@@ -131,6 +183,13 @@ void SetTimeScreen::back() {
 
 void SetTimeScreen::menu() {
   if (setIndex == numFields - 1) {
+    tm = {};
+    tm.tm_min = settingValues[SET_MINUTE];
+    tm.tm_hour = settingValues[SET_HOUR];
+    tm.tm_mday = settingValues[SET_DAY];
+    tm.tm_mon = settingValues[SET_MONTH];
+    tm.tm_year = settingValues[SET_YEAR];
+    tm.tm_isdst = -1;  // whatever it is on that day
     time_t t = mktime(&tm);
     setTime(t);
     tmElements_t tme;
@@ -139,6 +198,7 @@ void SetTimeScreen::menu() {
     timeval tv = {t, 0};
     settimeofday(&tv, nullptr);
     setIndex = 0;  // make sure we start at the beginning if we come back
+    setting = false;
     Watchy::setScreen(parent);
   } else {
     setIndex++;
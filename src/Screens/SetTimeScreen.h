@@ -5,6 +5,7 @@
 class SetTimeScreen : public Screen {
  private:
   static uint8_t setIndex;
+  void drawPiece(uint8_t i, uint16_t color);
 
  public:
   int16_t minute;
@@ -16,6 +17,8 @@ class SetTimeScreen : public Screen {
  public:
   SetTimeScreen(uint16_t bg = GxEPD_WHITE) : Screen(bg) {}
   void show() override;
+  // the blink toggles on every frame, so the next second's frame is known
+  bool showAt(time_t t) override;
   void up() override;
   void down() override;
   void back() override;
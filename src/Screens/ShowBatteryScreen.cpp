@@ -3,6 +3,7 @@
 #include <time.h>
 
 #include "OptimaLTStd12pt7b.h"
+#include "Timer.h"
 #include "Watchy.h"
 
 const int batteryReadingssz = 24 * 7;
@@ -14,11 +15,11 @@ RTC_DATA_ATTR float batteryMin = 100;    // chosen so that it will be replaced b
 
 const time_t updateInterval = SECS_PER_HOUR;
 
-void OnWake(esp_sleep_wakeup_cause_t wakeup_reason) {
-  // setup
-  if ((lastReadingTS != 0) && (now() < lastReadingTS + updateInterval)) {
-    return;  // hasn't been an updateInterval yet
-  }
+void takeReadings();
+Watchy_Timer::Timer readingTimer("battery", &takeReadings);
+const Screen *batteryScreen;  // redrawn with each new reading
+
+void takeReadings() {
   do {
     batteryReadings[nextReading] = Watchy::getBatteryVoltage();
     nextReading = (nextReading + 1) % batteryReadingssz;
@@ -31,9 +32,20 @@ void OnWake(esp_sleep_wakeup_cause_t wakeup_reason) {
     }
     // catch up in case we slept for a very long time
   } while (now() >= lastReadingTS + updateInterval);
+  readingTimer.at(lastReadingTS + updateInterval);
+  if (Watchy::screen == batteryScreen) {
+    Watchy::markDirty();
+  }
+}
+
+void OnWake(esp_sleep_wakeup_cause_t wakeup_reason) {
+  if (readingTimer.due() == 0) {
+    readingTimer.at(now());  // first wake, take the first reading now
+  }
 }
 
 ShowBatteryScreen::ShowBatteryScreen(uint16_t bg) : Screen(bg) {
+  batteryScreen = this;
   Watchy::AddOnWakeCallback(&OnWake);
 }
 
@@ -45,7 +57,8 @@ float mapRange(const float v, const float inMax, const float inMin,
 }
 
 void ShowBatteryScreen::show() {
-  Watchy::RTC.setRefresh(RTC_REFRESH_MIN);
+  // redrawn when the next reading is taken
+  Watchy::RTC.setRefresh(RTC_REFRESH_NONE);
   float fgColor = (bgColor == GxEPD_WHITE ? GxEPD_BLACK : GxEPD_WHITE);
   float batteryPresent = Watchy::getBatteryVoltage();
   
@@ -3,9 +3,16 @@
 #include "OptimaLTStd22pt7b.h"
 #include "Watchy.h"
 
+// the step count can't be known ahead of time, so it is sampled this often
+const time_t updateInterval = 5 * SECS_PER_MIN;
+
 void ShowStepsScreen::show() {
-  Watchy::RTC.setRefresh(RTC_REFRESH_MIN);
+  Watchy::RTC.setRefresh(RTC_REFRESH_ALARM);
   Watchy::display.fillScreen(bgColor);
   Watchy::display.setFont(OptimaLTStd22pt7b);
   Watchy::display.printf("\n%d\nsteps", Watchy::sensor.getCounter());
 }
+
+time_t ShowStepsScreen::nextChange(time_t t) const {
+  return (t / updateInterval + 1) * updateInterval;
+}
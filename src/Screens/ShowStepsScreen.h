@@ -6,4 +6,5 @@ class ShowStepsScreen : public Screen {
  public:
   ShowStepsScreen(uint16_t bg = GxEPD_WHITE) : Screen(bg) {}
   void show() override;
+  time_t nextChange(time_t t) const override;
 };
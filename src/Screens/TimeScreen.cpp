@@ -3,78 +3,75 @@
 #include <stdlib.h>
 #include <time.h>
 
-#include "OptimaLTStd22pt7b.h"
 #include "OptimaLTStd7pt7b.h"
-#include "OptimaLTStd_Black32pt7b.h"
 #include "GetLocation.h"
+#include "TimeWords.h"
+#include "rle.h"
 
 using namespace Watchy;
 
-// inspired by http://rosettacode.org/wiki/Number_names#C.2B.2B
-const char *smallNumbers[] = {"",        "one",       "two",      "three",
-                              "four",    "five",      "six",      "seven",
-                              "eight",   "nine",      "ten",      "eleven",
-                              "twelve",  "thirteen",  "fourteen", "fifteen",
-                              "sixteen", "seventeen", "eighteen", "nineteen"};
-const char *decades[] = {"oh", nullptr, "twenty", "thirty", "forty", "fifty"};
-
-void rightJustify(const char *txt, uint16_t &yPos) {
-  int16_t x1, y1;
-  uint16_t w, h;
-  const uint8_t PADDING = 0; // how much padding to leave around text
-  display.getTextBounds(txt, 0, 0, &x1, &y1, &w, &h);
-  // right justify with padding
-  display.setCursor(200-x1-w-PADDING, yPos);
-  display.print(txt);  
+// the words are pre-rendered by tools/timewords.py, see TimeWords.h
+void drawWord(const TimeWord &w, uint16_t yPos, uint16_t color) {
+  if (w.image) {
+    drawRLEBitmap(display, w.x, yPos + w.top, w.image, color);
+  }
 }
 
 void TimeScreen::show() {
-  Watchy::RTC.setRefresh(RTC_REFRESH_MIN);
+  Watchy::RTC.setRefresh(refreshMode());
+  showAt(now());
+}
+
+// FNV-1a over the minute and the time zone's POSIX spec
+uint32_t TimeScreen::frameVersion() const {
+  const uint32_t FNV_PRIME = 16777619u;
+  uint32_t version = 2166136261u;
+  const uint32_t minute = now() / SECS_PER_MIN;
+  for (uint8_t i = 0; i < sizeof(minute); i++) {
+    version = (version ^ ((minute >> (8 * i)) & 0xFF)) * FNV_PRIME;
+  }
+  for (const char *c = Watchy_GetLocation::currentLocation.timezone; *c; c++) {
+    version = (version ^ uint8_t(*c)) * FNV_PRIME;
+  }
+  return version == 0 ? 1 : version;  // 0 would mean it can't be kept
+}
+
+bool TimeScreen::showAt(time_t tt) {
   tm t;
-  time_t tt = now();
   localtime_r(&tt, &t);
 
   Watchy::display.fillScreen(bgColor);
+  const uint16_t fgColor = (bgColor == GxEPD_WHITE ? GxEPD_BLACK : GxEPD_WHITE);
 
   // hours
-  const GFXfont * font = OptimaLTStd_Black32pt7b;
-  display.setFont(font);
-  uint16_t yPos = font->yAdvance; // assume cursor(0,0)
-  rightJustify(smallNumbers[(t.tm_hour + 11) % 12 + 1], yPos);
+  uint16_t yPos = hourYAdvance; // assume cursor(0,0)
+  drawWord(hourWords[(t.tm_hour + 11) % 12 + 1], yPos, fgColor);
 
   // minutes
-  font = OptimaLTStd22pt7b;
-  display.setFont(font);
-  yPos += font->yAdvance;
-  const char *txt;
+  yPos += minuteYAdvance;
   assert(t.tm_min >= 0 && t.tm_min < 60);
   if (t.tm_min == 0) {
     // 0: exactly on the hour
     if (t.tm_hour == 0) {
-      txt = "midnight";
+      drawWord(onTheHourWords[MIDNIGHT], yPos, fgColor);
     } else if (t.tm_hour == 12) {
-      txt = "noon";
+      drawWord(onTheHourWords[NOON], yPos, fgColor);
     } else {
-      txt = "o'clock";
+      drawWord(onTheHourWords[OCLOCK], yPos, fgColor);
     }
   } else if (10 <= t.tm_min && t.tm_min < 20) {
     // 10-19
-    txt = smallNumbers[t.tm_min];
+    drawWord(minuteWords[t.tm_min], yPos, fgColor);
   } else if (t.tm_min <= 59) {
     // 1-9, 20-59
-    rightJustify(decades[t.tm_min / 10], yPos);
-    yPos += font->yAdvance;
-    txt = smallNumbers[t.tm_min % 10];
+    drawWord(decadeWords[t.tm_min / 10], yPos, fgColor);
+    yPos += minuteYAdvance;
+    drawWord(minuteWords[t.tm_min % 10], yPos, fgColor);
   }
-  // ignore warning about txt not initialized, assert guarantees it will be
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
-  rightJustify(txt, yPos);
-  #pragma GCC diagnostic pop
 
   // date
   display.setCursor(0, 195);
   display.setFont(OptimaLTStd7pt7b);
   display.print(&t, "%a, %B %d %Y %Z");
-  loop(); // TESTING
+  return true;
 }
\ No newline at end of file
@@ -6,4 +6,8 @@ class TimeScreen : public Screen {
  public:
   TimeScreen(uint16_t bg = GxEPD_WHITE) : Screen(bg) {}
   void show() override;
+  RTC_REFRESH_t refreshMode() const override { return RTC_REFRESH_MIN; }
+  bool showAt(time_t t) override;  // only depends on the time
+  // changes with the minute, and with the time zone
+  uint32_t frameVersion() const override;
 };
@@ -0,0 +1,984 @@
+// generated by tools/timewords.py from OptimaLTStd_Black32pt7b and OptimaLTStd22pt7b, do not edit
+
+#include "TimeWords.h"
+
+// 107x33, 245 bytes, delta rows
+const uint8_t runs_hourWords_one[] = {
+    12, 10, 34, 7, 25, 9, 19, 3, 10, 3, 15, 10, 4, 2, 7, 3,
+    19, 3, 9, 3, 14, 2, 16, 2, 25, 2, 12, 1, 16, 2, 15, 1,
+    12, 1, 8, 4, 8, 2, 22, 1, 15, 1, 14, 1, 7, 4, 7, 1,
+    10, 1, 8, 1, 4, 2, 8, 1, 20, 1, 17, 1, 12, 1, 7, 1,
+    4, 1, 7, 1, 8, 1, 8, 1, 16, 1, 49, 1, 7, 1, 6, 1,
+    7, 1, 6, 1, 8, 1, 8, 1, 33, 1, 23, 1, 24, 1, 33, 1,
+    20, 3, 1, 2, 11, 1, 39, 1, 19, 1, 28, 1, 6, 1, 19, 1,
+    8, 1, 17, 1, 12, 1, 20, 1, 75, 1, 57, 1, 17, 1, 18, 1,
+    60, 1, 89, 1, 160, 1, 10, 116, 1, 106, 2, 193, 1, 19, 1, 1,
+    246, 1, 1, 139, 2, 1, 20, 1, 30, 1, 44, 1, 40, 1, 10, 1,
+    65, 1, 15, 1, 4, 1, 28, 1, 46, 1, 24, 1, 92, 2, 10, 2,
+    7, 1, 8, 1, 8, 1, 8, 1, 48, 1, 11, 2, 6, 2, 10, 1,
+    8, 1, 6, 1, 8, 1, 50, 1, 12, 6, 5, 1, 7, 1, 8, 1,
+    4, 1, 8, 1, 52, 1, 31, 1, 8, 4, 8, 1, 54, 1, 20, 1,
+    10, 2, 16, 2, 56, 2, 16, 2, 13, 3, 10, 3, 15, 10, 10, 10,
+    15, 3, 10, 3, 6,
+};
+const rle2 rle_hourWords_one = {107, 33, RLE2_DELTA, 0, nullptr, runs_hourWords_one};
+
+// 105x43, 262 bytes, delta rows
+const uint8_t runs_hourWords_two[] = {
+    12, 2, 101, 2, 101, 2, 101, 2, 101, 2, 195, 5, 10, 12, 4, 10,
+    5, 1, 12, 10, 9, 11, 7, 11, 3, 10, 3, 29, 1, 30, 1, 16,
+    1, 9, 2, 16, 2, 84, 1, 8, 4, 8, 2, 66, 1, 5, 1, 8,
+    1, 8, 1, 4, 2, 8, 1, 4, 4, 10, 5, 2, 1, 19, 1, 33,
+    1, 8, 1, 16, 1, 35, 1, 19, 1, 21, 1, 8, 1, 8, 1, 78,
+    1, 35, 1, 24, 1, 17, 1, 19, 1, 12, 1, 19, 1, 76, 1, 16,
+    1, 20, 1, 14, 1, 19, 1, 19, 1, 18, 1, 55, 1, 120, 1, 19,
+    1, 4, 1, 39, 1, 129, 1, 1, 9, 1, 8, 2, 9, 1, 88, 1,
+    24, 1, 99, 1, 12, 1, 58, 1, 16, 1, 2, 1, 9, 1, 6, 1,
+    77, 1, 1, 1, 33, 1, 90, 1, 73, 1, 14, 1, 4, 1, 14, 1,
+    42, 1, 36, 1, 19, 1, 213, 1, 1, 11, 1, 30, 1, 28, 1, 12,
+    1, 6, 1, 34, 1, 10, 1, 84, 1, 28, 1, 15, 1, 45, 1, 73,
+    1, 10, 1, 8, 1, 25, 1, 8, 1, 8, 1, 8, 1, 17, 1, 60,
+    1, 8, 1, 6, 1, 8, 1, 8, 1, 10, 4, 39, 1, 17, 1, 8,
+    1, 4, 1, 8, 1, 10, 1, 71, 1, 8, 4, 8, 1, 12, 1, 22,
+    1, 8, 1, 10, 1, 28, 2, 16, 2, 14, 2, 7, 3, 11, 8, 12,
+    8, 22, 3, 10, 3, 9,
+};
+const rle2 rle_hourWords_two = {105, 43, RLE2_DELTA, 0, nullptr, runs_hourWords_two};
+
+// 150x47, 312 bytes, delta rows
+const uint8_t runs_hourWords_three[] = {
+    24, 11, 149, 1, 1, 171, 3, 2, 146, 1, 2, 146, 1, 2, 146, 1,
+    2, 146, 1, 2, 166, 7, 7, 30, 4, 15, 9, 26, 9, 10, 4, 10,
+    5, 19, 2, 7, 3, 12, 10, 3, 2, 16, 3, 9, 3, 20, 3, 9,
+    3, 43, 2, 12, 1, 23, 1, 16, 2, 15, 1, 17, 2, 15, 1, 41,
+    1, 15, 1, 21, 1, 16, 1, 7, 4, 7, 1, 15, 1, 7, 4, 7,
+    1, 39, 1, 17, 1, 36, 1, 7, 1, 4, 1, 7, 1, 13, 1, 7,
+    1, 4, 1, 7, 1, 4, 4, 10, 5, 53, 1, 15, 1, 7, 1, 6,
+    1, 7, 1, 11, 1, 7, 1, 6, 1, 7, 1, 40, 5, 45, 1, 24,
+    1, 9, 1, 24, 1, 38, 1, 5, 1, 10, 1, 131, 1, 1, 50, 1,
+    8, 1, 17, 1, 7, 1, 8, 1, 17, 1, 44, 1, 32, 1, 86, 1,
+    20, 1, 39, 2, 1, 2, 1, 1, 4, 1, 18, 1, 15, 1, 18, 1,
+    83, 1, 5, 1, 164, 2, 1, 22, 10, 25, 10, 124, 1, 34, 1, 114,
+    1, 34, 1, 245, 1, 19, 16, 19, 184, 5, 1, 34, 1, 104, 1, 34,
+    1, 125, 1, 15, 1, 18, 1, 15, 1, 88, 1, 24, 1, 9, 1, 24,
+    1, 16, 1, 83, 2, 10, 2, 21, 2, 10, 2, 91, 1, 11, 2, 6,
+    2, 13, 1, 11, 2, 6, 2, 20, 1, 73, 1, 12, 6, 5, 1, 10,
+    1, 12, 6, 5, 1, 6, 1, 10, 4, 70, 1, 34, 1, 30, 1, 66,
+    1, 17, 1, 20, 1, 13, 1, 20, 1, 9, 1, 36, 1, 47, 2, 16,
+    2, 15, 2, 16, 2, 11, 2, 7, 3, 5, 10, 9, 11, 8, 11, 20,
+    3, 10, 3, 19, 3, 10, 3, 6,
+};
+const rle2 rle_hourWords_three = {150, 47, RLE2_DELTA, 0, nullptr, runs_hourWords_three};
+
+// 119x48, 236 bytes, delta rows
+const uint8_t runs_hourWords_four[] = {
+    14, 7, 110, 2, 6, 1, 109, 1, 117, 1, 117, 1, 117, 1, 117, 1,
+    123, 4, 109, 1, 4, 1, 4, 3, 110, 1, 8, 1, 104, 1, 4, 1,
+    229, 2, 1, 111, 1, 126, 1, 21, 10, 71, 8, 9, 6, 12, 3, 10,
+    3, 15, 11, 9, 10, 8, 10, 3, 2, 33, 2, 16, 2, 63, 1, 6,
+    1, 27, 1, 8, 4, 8, 2, 60, 1, 7, 1, 26, 1, 8, 1, 4,
+    2, 8, 1, 10, 1, 56, 4, 10, 5, 7, 1, 8, 1, 16, 1, 57,
+    1, 33, 1, 8, 1, 8, 1, 128, 1, 1, 89, 1, 19, 1, 107, 1,
+    20, 1, 59, 1, 27, 1, 88, 2, 1, 2, 1, 1, 91, 1, 19, 1,
+    5, 1, 56, 1, 173, 1, 1, 140, 2, 1, 237, 1, 1, 142, 2, 1,
+    35, 1, 160, 2, 1, 30, 1, 26, 1, 70, 1, 10, 1, 98, 1, 28,
+    1, 19, 1, 6, 1, 112, 1, 4, 1, 64, 1, 8, 1, 8, 1, 8,
+    1, 10, 1, 11, 4, 66, 1, 8, 1, 6, 1, 8, 1, 29, 1, 64,
+    1, 8, 1, 4, 1, 8, 1, 13, 1, 82, 1, 8, 4, 8, 1, 15,
+    1, 14, 1, 29, 1, 37, 2, 16, 2, 17, 1, 11, 2, 43, 10, 17,
+    3, 10, 3, 20, 2, 7, 2, 4, 10, 8, 11, 8,
+};
+const rle2 rle_hourWords_four = {119, 48, RLE2_DELTA, 0, nullptr, runs_hourWords_four};
+
+// 101x48, 262 bytes, delta rows
+const uint8_t runs_hourWords_five[] = {
+    14, 7, 5, 5, 82, 2, 6, 1, 4, 1, 5, 1, 80, 1, 12, 1,
+    7, 1, 78, 1, 22, 1, 76, 1, 13, 1, 85, 1, 99, 1, 105, 4,
+    7, 1, 9, 1, 73, 1, 4, 1, 4, 3, 92, 1, 8, 1, 4, 2,
+    6, 1, 73, 1, 4, 1, 15, 6, 154, 2, 1, 93, 1, 108, 1, 69,
+    9, 10, 4, 9, 6, 4, 11, 4, 11, 13, 6, 11, 3, 9, 3, 30,
+    1, 37, 1, 15, 2, 15, 1, 6, 1, 48, 1, 17, 1, 8, 1, 7,
+    4, 7, 1, 5, 1, 37, 1, 36, 1, 7, 1, 4, 1, 7, 1, 4,
+    4, 10, 5, 47, 1, 7, 1, 7, 1, 6, 1, 7, 1, 42, 1, 20,
+    1, 12, 1, 24, 1, 35, 1, 16, 1, 14, 1, 107, 1, 8, 1, 17,
+    1, 41, 1, 18, 1, 92, 1, 12, 1, 6, 1, 18, 1, 51, 1, 117,
+    1, 105, 1, 17, 10, 52, 1, 9, 1, 47, 1, 57, 1, 4, 1, 37,
+    1, 144, 1, 1, 9, 1, 27, 19, 57, 1, 4, 1, 184, 1, 1, 9,
+    1, 101, 1, 4, 1, 73, 1, 47, 1, 64, 1, 13, 1, 11, 1, 111,
+    1, 15, 1, 74, 1, 24, 1, 49, 1, 11, 1, 24, 2, 10, 2, 77,
+    1, 11, 2, 6, 2, 80, 1, 12, 6, 5, 1, 49, 1, 9, 1, 17,
+    1, 101, 1, 20, 1, 26, 1, 53, 2, 16, 2, 8, 10, 9, 11, 14,
+    9, 22, 3, 10, 3, 6,
+};
+const rle2 rle_hourWords_five = {101, 48, RLE2_DELTA, 0, nullptr, runs_hourWords_five};
+
+// 72x48, 265 bytes, delta rows
+const uint8_t runs_hourWords_six[] = {
+    31, 5, 66, 1, 5, 1, 64, 1, 7, 1, 72, 1, 61, 1, 215, 1,
+    1, 9, 1, 134, 1, 2, 6, 1, 65, 6, 202, 2, 9, 61, 2, 9,
+    3, 9, 11, 4, 12, 10, 7, 3, 2, 14, 2, 7, 1, 14, 1, 11,
+    1, 8, 1, 6, 1, 2, 1, 41, 1, 25, 1, 2, 1, 6, 7, 5,
+    1, 35, 1, 6, 1, 15, 1, 7, 2, 28, 1, 23, 1, 2, 1, 56,
+    1, 4, 1, 5, 1, 20, 1, 20, 1, 7, 1, 14, 1, 5, 1, 23,
+    1, 27, 1, 10, 1, 7, 1, 12, 1, 10, 1, 41, 1, 19, 1, 39,
+    1, 10, 1, 5, 1, 15, 3, 52, 1, 19, 3, 34, 1, 13, 1, 23,
+    2, 33, 1, 38, 2, 43, 1, 9, 1, 18, 1, 31, 1, 10, 1, 29,
+    1, 52, 1, 50, 1, 10, 1, 10, 2, 17, 1, 42, 1, 11, 1, 47,
+    1, 24, 2, 44, 1, 13, 1, 13, 3, 40, 1, 31, 2, 26, 1, 16,
+    1, 10, 1, 17, 2, 35, 1, 23, 1, 12, 1, 33, 1, 5, 1, 1,
+    1, 10, 1, 6, 1, 50, 1, 14, 1, 3, 1, 20, 1, 25, 1, 9,
+    1, 17, 1, 10, 1, 31, 1, 5, 1, 5, 1, 10, 1, 6, 1, 15,
+    1, 24, 1, 24, 1, 6, 4, 1, 4, 5, 1, 24, 1, 6, 1, 7,
+    1, 21, 1, 8, 1, 52, 2, 16, 1, 10, 1, 14, 1, 6, 1, 22,
+    4, 9, 3, 11, 11, 4, 7, 10, 12,
+};
+const rle2 rle_hourWords_six = {72, 48, RLE2_DELTA, 0, nullptr, runs_hourWords_six};
+
+// 160x33, 408 bytes, delta rows
+const uint8_t runs_hourWords_seven[] = {
+    7, 9, 23, 9, 57, 9, 32, 7, 12, 2, 9, 3, 17, 3, 9, 3,
+    10, 11, 13, 6, 11, 3, 9, 3, 13, 10, 4, 2, 7, 3, 7, 2,
+    14, 2, 13, 2, 15, 1, 32, 1, 15, 2, 15, 1, 24, 2, 12, 1,
+    5, 1, 30, 1, 7, 4, 7, 1, 19, 1, 17, 1, 8, 1, 7, 4,
+    7, 1, 22, 1, 15, 1, 3, 1, 6, 7, 5, 1, 11, 1, 7, 1,
+    4, 1, 7, 1, 7, 1, 36, 1, 7, 1, 4, 1, 7, 1, 20, 1,
+    17, 1, 8, 1, 7, 2, 14, 1, 7, 1, 6, 1, 7, 1, 34, 1,
+    7, 1, 7, 1, 6, 1, 7, 1, 39, 1, 29, 1, 24, 1, 6, 1,
+    20, 1, 12, 1, 24, 1, 23, 1, 31, 1, 55, 1, 14, 1, 53, 3,
+    1, 2, 11, 1, 19, 1, 9, 1, 8, 1, 17, 1, 38, 1, 8, 1,
+    17, 1, 18, 1, 6, 1, 18, 1, 10, 1, 44, 1, 18, 1, 85, 1,
+    19, 1, 18, 1, 26, 1, 12, 1, 6, 1, 18, 1, 35, 1, 19, 3,
+    52, 1, 75, 1, 31, 3, 66, 1, 93, 2, 21, 10, 38, 1, 17, 10,
+    63, 2, 38, 1, 7, 1, 9, 1, 47, 1, 36, 1, 18, 1, 37, 1,
+    22, 1, 4, 1, 37, 1, 56, 1, 140, 1, 1, 36, 19, 9, 1, 9,
+    1, 27, 19, 39, 2, 17, 1, 57, 1, 4, 1, 79, 1, 160, 1, 2,
+    60, 1, 9, 1, 89, 3, 68, 1, 4, 1, 86, 2, 26, 1, 65, 1,
+    67, 2, 14, 1, 39, 1, 13, 1, 11, 1, 66, 1, 12, 1, 24, 1,
+    15, 1, 49, 1, 15, 1, 40, 1, 26, 1, 24, 1, 40, 1, 24, 1,
+    39, 1, 20, 1, 18, 2, 10, 2, 15, 1, 11, 1, 24, 2, 10, 2,
+    43, 1, 10, 1, 15, 1, 11, 2, 6, 2, 44, 1, 11, 2, 6, 2,
+    46, 1, 15, 1, 10, 1, 12, 6, 5, 1, 41, 1, 12, 6, 5, 1,
+    43, 4, 1, 4, 5, 1, 12, 1, 37, 1, 9, 1, 17, 1, 70, 1,
+    8, 1, 14, 1, 20, 1, 44, 1, 20, 1, 39, 1, 16, 1, 16, 2,
+    16, 2, 46, 2, 16, 2, 41, 4, 9, 3, 19, 3, 10, 3, 19, 9,
+    22, 3, 10, 3, 12, 10, 10, 10,
+};
+const rle2 rle_hourWords_seven = {160, 33, RLE2_DELTA, 0, nullptr, runs_hourWords_seven};
+
+// 142x64, 398 bytes, delta rows
+const uint8_t runs_hourWords_eight[] = {
+    38, 5, 136, 1, 1, 5, 1, 44, 11, 79, 1, 7, 1, 53, 1, 88,
+    1, 131, 1, 1, 241, 1, 2, 138, 1, 2, 42, 1, 9, 1, 85, 2,
+    138, 1, 2, 47, 2, 6, 1, 82, 2, 51, 6, 165, 5, 9, 40, 12,
+    32, 7, 39, 3, 9, 3, 12, 11, 11, 3, 12, 10, 20, 2, 7, 3,
+    9, 4, 10, 5, 6, 2, 15, 1, 11, 1, 19, 2, 43, 2, 12, 1,
+    32, 1, 7, 4, 7, 1, 29, 1, 8, 4, 32, 1, 15, 1, 30, 1,
+    7, 1, 4, 1, 7, 1, 27, 1, 8, 1, 4, 1, 9, 5, 16, 1,
+    17, 1, 28, 1, 7, 1, 6, 1, 7, 1, 41, 1, 8, 1, 45, 4,
+    10, 5, 2, 1, 24, 1, 24, 1, 48, 5, 81, 1, 15, 1, 38, 1,
+    5, 1, 10, 1, 25, 1, 8, 1, 17, 1, 49, 1, 20, 1, 149, 1,
+    1, 34, 1, 18, 1, 78, 1, 37, 1, 171, 2, 10, 58, 1, 92, 1,
+    141, 1, 1, 22, 1, 8, 1, 15, 1, 117, 1, 14, 1, 83, 19, 25,
+    1, 7, 1, 4, 1, 8, 1, 120, 1, 7, 4, 7, 2, 122, 2, 14,
+    2, 126, 1, 3, 1, 5, 4, 126, 3, 2, 1, 1, 5, 84, 1, 34,
+    1, 9, 1, 86, 1, 53, 1, 5, 1, 92, 1, 15, 1, 25, 1, 6,
+    1, 82, 1, 24, 1, 34, 2, 91, 2, 10, 2, 37, 14, 59, 1, 7,
+    1, 11, 2, 6, 2, 53, 2, 66, 1, 12, 6, 5, 1, 51, 1, 57,
+    1, 8, 1, 48, 1, 26, 1, 46, 1, 10, 4, 5, 1, 20, 1, 27,
+    1, 73, 1, 19, 2, 16, 2, 9, 1, 19, 1, 25, 1, 25, 1, 21,
+    1, 20, 3, 10, 3, 11, 11, 10, 1, 31, 10, 9, 11, 12, 2, 7,
+    3, 11, 10, 34, 2, 3, 11, 61, 7, 56, 2, 4, 1, 11, 2, 121,
+    1, 5, 1, 14, 1, 119, 1, 147, 1, 1, 16, 1, 162, 2, 1, 134,
+    1, 1, 124, 1, 22, 1, 134, 1, 1, 119, 1, 6, 1, 13, 1, 6,
+    1, 121, 2, 10, 1, 6, 1, 115, 1, 8, 3, 3, 4, 6, 1, 117,
+    1, 10, 3, 8, 2, 119, 2, 17, 2, 123, 3, 10, 4, 69,
+};
+const rle2 rle_hourWords_eight = {142, 64, RLE2_DELTA, 0, nullptr, runs_hourWords_eight};
+
+// 122x48, 222 bytes, delta rows
+const uint8_t runs_hourWords_nine[] = {
+    40, 5, 116, 1, 5, 1, 114, 1, 7, 1, 122, 1, 111, 1, 237, 2,
+    1, 9, 1, 234, 1, 2, 6, 1, 115, 6, 196, 4, 7, 48, 7, 25,
+    9, 10, 10, 4, 2, 7, 3, 11, 11, 7, 10, 4, 2, 7, 3, 19,
+    3, 9, 3, 19, 2, 12, 1, 10, 1, 29, 2, 12, 1, 16, 2, 15,
+    1, 17, 1, 15, 1, 38, 1, 15, 1, 14, 1, 7, 4, 7, 1, 15,
+    1, 17, 1, 36, 1, 17, 1, 12, 1, 7, 1, 4, 1, 7, 1, 99,
+    1, 7, 1, 6, 1, 7, 1, 18, 1, 54, 1, 23, 1, 24, 1, 14,
+    3, 1, 2, 11, 1, 17, 1, 19, 3, 1, 2, 11, 1, 48, 1, 6,
+    1, 47, 1, 6, 1, 19, 1, 8, 1, 17, 1, 142, 1, 1, 54, 1,
+    17, 1, 18, 1, 20, 1, 54, 1, 152, 2, 10, 131, 1, 1, 121, 1,
+    224, 1, 19, 152, 4, 1, 54, 1, 111, 1, 132, 1, 1, 15, 1, 95,
+    1, 24, 1, 107, 2, 10, 2, 98, 1, 11, 2, 6, 2, 101, 1, 12,
+    6, 5, 1, 98, 1, 122, 1, 20, 1, 40, 1, 60, 2, 16, 2, 4,
+    10, 10, 10, 7, 11, 7, 10, 10, 10, 15, 3, 10, 3, 6,
+};
+const rle2 rle_hourWords_nine = {122, 48, RLE2_DELTA, 0, nullptr, runs_hourWords_nine};
+
+// 89x43, 176 bytes, delta rows
+const uint8_t runs_hourWords_ten[] = {
+    12, 2, 85, 2, 85, 2, 85, 2, 85, 2, 178, 4, 9, 32, 7, 7,
+    4, 10, 5, 12, 3, 9, 3, 13, 10, 4, 2, 7, 3, 33, 2, 15,
+    1, 24, 2, 12, 1, 31, 1, 7, 4, 7, 1, 22, 1, 15, 1, 29,
+    1, 7, 1, 4, 1, 7, 1, 20, 1, 17, 1, 1, 4, 10, 5, 7,
+    1, 7, 1, 6, 1, 7, 1, 64, 1, 24, 1, 23, 1, 85, 3, 1,
+    2, 11, 1, 24, 1, 8, 1, 17, 1, 18, 1, 6, 1, 113, 1, 9,
+    1, 18, 1, 35, 1, 79, 1, 141, 1, 10, 98, 1, 88, 1, 158, 1,
+    19, 170, 3, 1, 78, 1, 99, 1, 15, 1, 62, 1, 24, 1, 52, 1,
+    21, 2, 10, 2, 65, 1, 11, 2, 6, 2, 56, 1, 11, 1, 12, 6,
+    5, 1, 42, 1, 10, 4, 8, 1, 66, 1, 22, 1, 20, 1, 45, 1,
+    22, 2, 16, 2, 47, 2, 7, 3, 12, 3, 10, 3, 12, 10, 10, 10,
+};
+const rle2 rle_hourWords_ten = {89, 43, RLE2_DELTA, 0, nullptr, runs_hourWords_ten};
+
+// 184x47, 416 bytes, delta rows
+const uint8_t runs_hourWords_eleven[] = {
+    35, 11, 157, 4, 1, 207, 15, 9, 43, 9, 57, 9, 32, 7, 15, 3,
+    9, 3, 37, 3, 9, 3, 10, 11, 13, 6, 11, 3, 9, 3, 13, 10,
+    4, 2, 7, 3, 10, 2, 15, 1, 34, 2, 15, 1, 32, 1, 15, 2,
+    15, 1, 24, 2, 12, 1, 8, 1, 7, 4, 7, 1, 32, 1, 7, 4,
+    7, 1, 19, 1, 17, 1, 8, 1, 7, 4, 7, 1, 22, 1, 15, 1,
+    6, 1, 7, 1, 4, 1, 7, 1, 30, 1, 7, 1, 4, 1, 7, 1,
+    7, 1, 36, 1, 7, 1, 4, 1, 7, 1, 20, 1, 17, 1, 4, 1,
+    7, 1, 6, 1, 7, 1, 28, 1, 7, 1, 6, 1, 7, 1, 34, 1,
+    7, 1, 7, 1, 6, 1, 7, 1, 41, 1, 24, 1, 26, 1, 24, 1,
+    6, 1, 20, 1, 12, 1, 24, 1, 23, 1, 111, 1, 14, 1, 53, 3,
+    1, 2, 11, 1, 1, 1, 8, 1, 17, 1, 24, 1, 8, 1, 17, 1,
+    38, 1, 8, 1, 17, 1, 18, 1, 6, 1, 98, 1, 18, 1, 77, 1,
+    18, 1, 32, 1, 18, 1, 26, 1, 12, 1, 6, 1, 18, 1, 35, 1,
+    98, 1, 75, 1, 124, 1, 88, 10, 42, 10, 38, 1, 17, 10, 75, 1,
+    51, 1, 7, 1, 9, 1, 47, 1, 65, 1, 51, 1, 22, 1, 4, 1,
+    37, 1, 230, 1, 19, 33, 19, 9, 1, 9, 1, 27, 19, 140, 1, 1,
+    4, 1, 222, 2, 1, 9, 1, 184, 1, 1, 4, 1, 86, 1, 51, 1,
+    65, 1, 55, 1, 51, 1, 39, 1, 13, 1, 11, 1, 76, 1, 15, 1,
+    35, 1, 15, 1, 49, 1, 15, 1, 39, 1, 24, 1, 26, 1, 24, 1,
+    40, 1, 24, 1, 51, 2, 10, 2, 38, 2, 10, 2, 15, 1, 11, 1,
+    24, 2, 10, 2, 42, 1, 11, 2, 6, 2, 30, 1, 11, 2, 6, 2,
+    44, 1, 11, 2, 6, 2, 45, 1, 12, 6, 5, 1, 27, 1, 12, 6,
+    5, 1, 41, 1, 12, 6, 5, 1, 42, 1, 30, 1, 20, 1, 37, 1,
+    9, 1, 17, 1, 66, 1, 20, 1, 30, 1, 20, 1, 44, 1, 20, 1,
+    45, 2, 16, 2, 32, 2, 16, 2, 46, 2, 16, 2, 48, 3, 10, 3,
+    11, 11, 14, 3, 10, 3, 19, 9, 22, 3, 10, 3, 12, 10, 10, 10,
+};
+const rle2 rle_hourWords_eleven = {184, 47, RLE2_DELTA, 0, nullptr, runs_hourWords_eleven};
+
+// 185x47, 435 bytes, delta rows
+const uint8_t runs_hourWords_twelve[] = {
+    107, 11, 160, 4, 1, 89, 2, 181, 1, 2, 181, 1, 2, 181, 1, 2,
+    181, 1, 2, 163, 9, 9, 74, 9, 10, 4, 10, 5, 1, 12, 10, 9,
+    11, 7, 11, 3, 9, 3, 27, 11, 13, 6, 11, 3, 9, 3, 27, 1,
+    30, 1, 16, 1, 9, 2, 15, 1, 49, 1, 15, 2, 15, 1, 83, 1,
+    7, 4, 7, 1, 36, 1, 17, 1, 8, 1, 7, 4, 7, 1, 66, 1,
+    5, 1, 8, 1, 7, 1, 4, 1, 7, 1, 24, 1, 36, 1, 7, 1,
+    4, 1, 7, 1, 4, 4, 10, 5, 2, 1, 19, 1, 33, 1, 7, 1,
+    6, 1, 7, 1, 51, 1, 7, 1, 7, 1, 6, 1, 7, 1, 35, 1,
+    19, 1, 21, 1, 24, 1, 23, 1, 20, 1, 12, 1, 24, 1, 68, 1,
+    67, 1, 14, 1, 57, 1, 17, 1, 19, 1, 12, 1, 8, 1, 17, 1,
+    55, 1, 8, 1, 17, 1, 66, 1, 58, 1, 18, 1, 54, 1, 19, 1,
+    19, 1, 18, 1, 18, 1, 43, 1, 12, 1, 6, 1, 18, 1, 33, 1,
+    101, 1, 98, 1, 19, 1, 4, 1, 77, 1, 124, 10, 55, 1, 17, 10,
+    34, 1, 9, 1, 8, 2, 9, 1, 46, 1, 24, 1, 9, 1, 47, 1,
+    38, 1, 24, 1, 37, 1, 39, 1, 4, 1, 37, 1, 58, 1, 151, 1,
+    1, 16, 1, 2, 1, 9, 1, 6, 1, 19, 19, 26, 1, 9, 1, 27,
+    19, 36, 1, 1, 1, 102, 1, 4, 1, 96, 1, 153, 1, 1, 14, 1,
+    4, 1, 14, 1, 66, 1, 9, 1, 82, 1, 19, 1, 82, 1, 4, 1,
+    122, 1, 82, 1, 79, 1, 11, 1, 56, 1, 13, 1, 11, 1, 56, 1,
+    12, 1, 6, 1, 35, 1, 15, 1, 66, 1, 15, 1, 75, 1, 24, 1,
+    57, 1, 24, 1, 16, 1, 45, 1, 24, 2, 10, 2, 32, 1, 11, 1,
+    24, 2, 10, 2, 32, 1, 10, 1, 8, 1, 25, 1, 11, 2, 6, 2,
+    61, 1, 11, 2, 6, 2, 20, 1, 60, 1, 12, 6, 5, 1, 58, 1,
+    12, 6, 5, 1, 6, 1, 10, 4, 39, 1, 17, 1, 30, 1, 23, 1,
+    9, 1, 17, 1, 30, 1, 71, 1, 20, 1, 61, 1, 20, 1, 9, 1,
+    22, 1, 8, 1, 10, 1, 28, 2, 16, 2, 63, 2, 16, 2, 11, 2,
+    7, 3, 11, 8, 12, 8, 22, 3, 10, 3, 11, 11, 14, 9, 22, 3,
+    10, 3, 6,
+};
+const rle2 rle_hourWords_twelve = {185, 47, RLE2_DELTA, 0, nullptr, runs_hourWords_twelve};
+
+// 67x22, 191 bytes, delta rows
+const uint8_t runs_minuteWords_one[] = {
+    8, 6, 20, 6, 15, 7, 10, 3, 2, 2, 2, 3, 9, 4, 2, 2,
+    6, 1, 12, 2, 3, 1, 3, 2, 7, 1, 2, 3, 2, 3, 2, 1,
+    13, 1, 2, 3, 4, 1, 10, 1, 2, 3, 1, 3, 2, 1, 5, 1,
+    2, 1, 8, 1, 2, 1, 11, 1, 1, 2, 3, 2, 3, 1, 8, 1,
+    2, 1, 10, 1, 3, 1, 16, 1, 11, 1, 18, 1, 11, 1, 9, 1,
+    10, 1, 9, 1, 3, 1, 8, 1, 3, 1, 9, 1, 12, 1, 1, 1,
+    18, 1, 28, 1, 13, 1, 74, 1, 47, 1, 31, 1, 34, 12, 3, 1,
+    114, 1, 3, 16, 47, 1, 35, 1, 53, 1, 47, 1, 82, 1, 18, 1,
+    28, 1, 22, 1, 10, 1, 36, 1, 15, 1, 16, 1, 6, 1, 23, 1,
+    3, 1, 10, 1, 4, 1, 2, 1, 8, 1, 2, 1, 32, 1, 3, 1,
+    7, 2, 6, 1, 2, 3, 2, 3, 2, 1, 34, 1, 3, 7, 1, 2,
+    6, 3, 2, 2, 3, 2, 9, 4, 10, 4, 9, 3, 6, 2, 3,
+};
+const rle2 rle_minuteWords_one = {67, 22, RLE2_DELTA, 0, nullptr, runs_minuteWords_one};
+
+// 67x27, 222 bytes, delta rows
+const uint8_t runs_minuteWords_two[] = {
+    5, 1, 63, 3, 137, 2, 1, 51, 6, 7, 3, 3, 4, 2, 4, 11,
+    3, 11, 3, 7, 3, 2, 2, 2, 3, 30, 1, 13, 1, 2, 1, 6,
+    1, 2, 3, 2, 3, 2, 1, 3, 3, 3, 4, 2, 1, 36, 1, 2,
+    1, 8, 1, 2, 1, 18, 1, 25, 1, 5, 1, 16, 1, 14, 1, 11,
+    1, 4, 1, 8, 1, 11, 1, 10, 1, 31, 1, 13, 1, 5, 1, 18,
+    1, 17, 1, 13, 1, 49, 1, 9, 1, 1, 1, 1, 1, 9, 1, 1,
+    1, 9, 1, 79, 1, 5, 1, 12, 1, 2, 1, 6, 1, 6, 1, 4,
+    1, 1, 1, 6, 1, 43, 1, 5, 1, 56, 1, 26, 1, 36, 1, 7,
+    1, 8, 1, 2, 1, 1, 1, 24, 1, 25, 1, 7, 1, 19, 1, 36,
+    1, 14, 1, 1, 1, 46, 1, 3, 1, 1, 1, 10, 1, 12, 1, 18,
+    1, 31, 1, 4, 1, 14, 1, 10, 1, 6, 1, 45, 1, 16, 1, 7,
+    1, 11, 1, 3, 1, 26, 1, 2, 1, 8, 1, 2, 1, 5, 1, 3,
+    1, 2, 1, 21, 1, 2, 1, 14, 1, 2, 3, 2, 3, 2, 1, 7,
+    1, 3, 3, 8, 3, 11, 2, 16, 3, 2, 2, 3, 2, 4,
+};
+const rle2 rle_minuteWords_two = {67, 27, RLE2_DELTA, 0, nullptr, runs_minuteWords_two};
+
+// 91x33, 240 bytes, delta rows
+const uint8_t runs_minuteWords_three[] = {
+    14, 4, 195, 3, 1, 81, 1, 87, 3, 233, 2, 1, 19, 6, 17, 4,
+    8, 7, 15, 7, 5, 3, 3, 4, 10, 2, 6, 1, 9, 4, 2, 1,
+    3, 1, 6, 2, 3, 1, 3, 2, 11, 2, 3, 1, 3, 2, 22, 1,
+    2, 3, 4, 1, 13, 1, 10, 1, 2, 3, 1, 3, 2, 1, 9, 1,
+    2, 3, 1, 3, 2, 1, 2, 3, 3, 4, 8, 1, 1, 2, 3, 2,
+    3, 1, 11, 1, 2, 2, 6, 1, 2, 1, 10, 1, 7, 1, 2, 1,
+    10, 1, 20, 1, 23, 2, 2, 1, 4, 1, 11, 1, 9, 1, 11, 1,
+    22, 1, 8, 1, 3, 1, 23, 1, 12, 1, 8, 1, 12, 1, 42, 1,
+    8, 1, 13, 1, 7, 1, 13, 1, 148, 1, 1, 21, 1, 68, 12, 10,
+    12, 5, 1, 138, 1, 1, 3, 15, 3, 1, 3, 15, 50, 1, 21, 1,
+    163, 1, 1, 21, 1, 119, 1, 36, 1, 21, 1, 72, 1, 21, 1, 15,
+    1, 49, 1, 3, 1, 10, 1, 6, 1, 3, 1, 10, 1, 7, 1, 46,
+    1, 3, 1, 7, 2, 8, 1, 3, 1, 7, 2, 5, 1, 3, 1, 2,
+    1, 43, 1, 3, 7, 1, 2, 8, 1, 3, 7, 1, 2, 5, 1, 3,
+    3, 3, 4, 10, 4, 6, 4, 13, 3, 6, 2, 11, 3, 6, 2, 3,
+};
+const rle2 rle_minuteWords_three = {91, 33, RLE2_DELTA, 0, nullptr, runs_minuteWords_three};
+
+// 73x34, 176 bytes, delta rows
+const uint8_t runs_minuteWords_four[] = {
+    9, 3, 68, 2, 70, 1, 71, 1, 1, 4, 68, 1, 4, 1, 65, 1,
+    217, 1, 1, 180, 2, 6, 43, 7, 3, 4, 7, 3, 2, 2, 2, 3,
+    9, 4, 10, 4, 6, 4, 2, 1, 3, 1, 16, 1, 2, 3, 2, 3,
+    2, 1, 37, 1, 5, 3, 3, 4, 5, 1, 2, 1, 8, 1, 2, 1,
+    35, 1, 2, 2, 16, 1, 16, 1, 23, 1, 11, 2, 2, 1, 18, 1,
+    10, 1, 57, 1, 18, 1, 33, 1, 95, 1, 24, 1, 60, 1, 55, 1,
+    145, 1, 1, 89, 1, 59, 1, 24, 1, 117, 1, 18, 1, 18, 1, 38,
+    1, 10, 1, 9, 1, 48, 1, 16, 1, 10, 1, 7, 1, 37, 1, 2,
+    1, 8, 1, 2, 1, 8, 1, 3, 2, 3, 2, 1, 1, 23, 1, 13,
+    1, 2, 3, 2, 3, 2, 1, 10, 1, 4, 3, 2, 1, 4, 1, 19,
+    4, 11, 3, 2, 2, 3, 2, 12, 1, 6, 2, 2, 4, 6, 4, 7,
+};
+const rle2 rle_minuteWords_four = {73, 34, RLE2_DELTA, 0, nullptr, runs_minuteWords_four};
+
+// 65x34, 181 bytes, delta rows
+const uint8_t runs_minuteWords_five[] = {
+    9, 3, 60, 2, 62, 1, 63, 1, 1, 4, 5, 2, 53, 1, 4, 1,
+    3, 1, 2, 1, 50, 1, 140, 1, 4, 49, 1, 181, 2, 7, 5, 3,
+    3, 4, 5, 4, 5, 4, 13, 2, 8, 2, 3, 1, 3, 2, 27, 1,
+    15, 1, 9, 1, 2, 3, 1, 3, 2, 1, 2, 3, 3, 4, 18, 1,
+    13, 1, 6, 1, 2, 1, 10, 1, 49, 1, 11, 1, 29, 1, 3, 1,
+    9, 1, 11, 1, 12, 1, 41, 1, 5, 1, 13, 1, 29, 1, 11, 1,
+    56, 1, 9, 1, 9, 1, 41, 1, 22, 12, 40, 1, 1, 1, 56, 1,
+    14, 1, 3, 15, 28, 1, 9, 1, 7, 1, 50, 1, 3, 1, 57, 1,
+    20, 1, 47, 1, 1, 1, 1, 1, 74, 1, 47, 1, 3, 1, 1, 1,
+    14, 1, 61, 1, 3, 1, 10, 1, 32, 1, 17, 1, 3, 1, 7, 2,
+    4, 1, 32, 1, 14, 1, 3, 7, 1, 2, 3, 4, 9, 4, 13, 3,
+    16, 3, 6, 2, 3,
+};
+const rle2 rle_minuteWords_five = {65, 34, RLE2_DELTA, 0, nullptr, runs_minuteWords_five};
+
+// 47x31, 172 bytes
+const uint8_t runs_minuteWords_six[] = {
+    20, 2, 44, 4, 43, 4, 43, 4, 135, 2, 6, 39, 10, 7, 4, 5,
+    5, 11, 3, 1, 3, 5, 2, 8, 4, 6, 5, 9, 3, 2, 2, 7,
+    1, 8, 4, 7, 4, 8, 3, 2, 3, 16, 4, 8, 4, 6, 3, 3,
+    3, 16, 4, 9, 4, 5, 2, 4, 3, 16, 4, 9, 4, 4, 2, 5,
+    4, 15, 4, 10, 4, 2, 2, 6, 5, 14, 4, 11, 6, 8, 7, 11,
+    4, 12, 5, 8, 9, 9, 4, 12, 4, 11, 9, 7, 4, 13, 4, 13,
+    7, 6, 4, 12, 6, 14, 5, 6, 4, 11, 2, 2, 4, 14, 4, 6,
+    4, 10, 3, 3, 3, 15, 3, 6, 4, 10, 2, 4, 4, 14, 3, 6,
+    4, 9, 2, 6, 4, 13, 3, 6, 4, 8, 2, 8, 4, 2, 2, 8,
+    2, 7, 4, 7, 3, 8, 4, 2, 3, 6, 2, 8, 4, 6, 3, 10,
+    4, 1, 10, 9, 4, 5, 3, 12, 4, 2, 6, 39,
+};
+const rle2 rle_minuteWords_six = {47, 31, 0, 0, nullptr, runs_minuteWords_six};
+
+// 102x22, 308 bytes, delta rows
+const uint8_t runs_minuteWords_seven[] = {
+    4, 6, 13, 7, 37, 7, 18, 6, 6, 2, 6, 2, 9, 2, 3, 1,
+    3, 2, 6, 4, 13, 2, 8, 2, 3, 1, 3, 2, 8, 4, 2, 2,
+    6, 1, 4, 1, 2, 5, 2, 1, 8, 1, 2, 3, 1, 3, 2, 1,
+    5, 1, 15, 1, 9, 1, 2, 3, 1, 3, 2, 1, 12, 1, 2, 3,
+    4, 1, 5, 1, 5, 1, 9, 1, 2, 1, 10, 1, 8, 1, 13, 1,
+    6, 1, 2, 1, 10, 1, 10, 1, 1, 2, 3, 2, 3, 1, 1, 1,
+    9, 1, 7, 1, 11, 1, 31, 1, 11, 1, 14, 1, 33, 1, 12, 1,
+    4, 1, 3, 1, 9, 1, 11, 1, 12, 1, 5, 1, 3, 1, 8, 1,
+    3, 1, 17, 1, 13, 1, 23, 1, 5, 1, 13, 1, 29, 1, 36, 1,
+    11, 1, 53, 1, 15, 1, 23, 1, 9, 1, 9, 1, 37, 1, 4, 3,
+    12, 12, 9, 1, 22, 12, 34, 2, 41, 1, 1, 1, 49, 2, 7, 2,
+    4, 1, 3, 15, 10, 1, 14, 1, 3, 15, 26, 3, 6, 1, 3, 1,
+    25, 1, 9, 1, 7, 1, 47, 2, 38, 1, 3, 1, 59, 1, 11, 1,
+    22, 1, 20, 1, 46, 1, 37, 1, 1, 1, 1, 1, 67, 1, 43, 1,
+    61, 1, 22, 1, 3, 1, 1, 1, 14, 1, 36, 2, 10, 1, 5, 1,
+    3, 1, 10, 1, 28, 1, 3, 1, 10, 1, 6, 1, 19, 1, 6, 1,
+    1, 1, 7, 1, 3, 1, 7, 2, 12, 1, 17, 1, 3, 1, 7, 2,
+    28, 6, 1, 1, 9, 1, 3, 7, 1, 2, 15, 1, 14, 1, 3, 7,
+    1, 2, 24, 2, 6, 2, 11, 3, 6, 2, 14, 3, 16, 3, 6, 2,
+    8, 4, 10, 4,
+};
+const rle2 rle_minuteWords_seven = {102, 22, RLE2_DELTA, 0, nullptr, runs_minuteWords_seven};
+
+// 91x44, 290 bytes, delta rows
+const uint8_t runs_minuteWords_eight[] = {
+    58, 4, 146, 1, 2, 88, 1, 2, 1, 211, 1, 1, 57, 4, 56, 1,
+    87, 3, 158, 2, 7, 26, 13, 13, 6, 10, 1, 13, 2, 3, 1, 3,
+    2, 9, 4, 9, 2, 2, 3, 4, 3, 12, 2, 6, 1, 7, 3, 3,
+    4, 5, 1, 2, 3, 1, 3, 2, 1, 20, 1, 2, 2, 3, 2, 2,
+    1, 2, 1, 10, 1, 2, 3, 4, 1, 20, 1, 2, 1, 10, 1, 18,
+    1, 2, 1, 10, 1, 11, 1, 1, 2, 3, 2, 3, 1, 5, 3, 3,
+    4, 3, 1, 11, 1, 32, 1, 15, 1, 32, 1, 12, 1, 16, 1, 26,
+    1, 8, 1, 3, 1, 16, 1, 13, 1, 170, 1, 1, 90, 12, 110, 1,
+    11, 1, 34, 1, 8, 1, 3, 15, 17, 1, 2, 1, 10, 1, 40, 1,
+    36, 1, 2, 1, 4, 2, 2, 1, 79, 1, 2, 4, 2, 2, 46, 1,
+    33, 1, 1, 7, 81, 1, 1, 1, 52, 1, 34, 1, 21, 1, 37, 1,
+    87, 1, 3, 1, 10, 1, 21, 8, 35, 1, 11, 1, 3, 1, 7, 2,
+    19, 1, 10, 4, 35, 1, 8, 1, 3, 7, 1, 2, 19, 1, 13, 1,
+    31, 1, 3, 1, 2, 1, 5, 3, 6, 2, 9, 4, 8, 1, 2, 8,
+    4, 1, 5, 4, 10, 4, 8, 1, 3, 3, 8, 6, 22, 1, 2, 1,
+    8, 1, 36, 5, 36, 1, 2, 1, 10, 1, 3, 1, 74, 1, 87, 1,
+    18, 1, 253, 1, 1, 2, 1, 14, 1, 87, 1, 76, 1, 2, 1, 9,
+    1, 2, 1, 75, 1, 2, 2, 4, 3, 1, 2, 77, 3, 1, 4, 2,
+    2, 42,
+};
+const rle2 rle_minuteWords_eight = {91, 44, RLE2_DELTA, 0, nullptr, runs_minuteWords_eight};
+
+// 77x31, 167 bytes, delta rows
+const uint8_t runs_minuteWords_nine[] = {
+    26, 2, 74, 1, 2, 1, 227, 1, 4, 236, 2, 6, 30, 6, 15, 7,
+    5, 4, 2, 2, 6, 1, 10, 4, 7, 4, 2, 2, 6, 1, 12, 2,
+    3, 1, 3, 2, 8, 1, 2, 3, 4, 1, 25, 1, 2, 3, 4, 1,
+    10, 1, 2, 3, 1, 3, 2, 1, 6, 1, 1, 2, 3, 2, 3, 1,
+    23, 1, 1, 2, 3, 2, 3, 1, 8, 1, 2, 1, 10, 1, 6, 1,
+    35, 1, 18, 1, 11, 1, 4, 1, 3, 1, 8, 1, 3, 1, 18, 1,
+    3, 1, 8, 1, 3, 1, 9, 1, 12, 1, 59, 1, 13, 1, 142, 1,
+    1, 76, 12, 138, 1, 1, 3, 15, 58, 1, 157, 1, 1, 150, 1, 1,
+    80, 1, 13, 1, 35, 1, 23, 1, 3, 1, 10, 1, 62, 1, 3, 1,
+    7, 2, 64, 1, 3, 7, 1, 2, 1, 4, 10, 4, 7, 4, 7, 4,
+    10, 4, 9, 3, 6, 2, 3,
+};
+const rle2 rle_minuteWords_nine = {77, 31, RLE2_DELTA, 0, nullptr, runs_minuteWords_nine};
+
+// 54x27, 141 bytes, delta rows
+const uint8_t runs_minuteWords_ten[] = {
+    5, 1, 50, 3, 213, 1, 1, 16, 7, 18, 6, 4, 3, 3, 4, 7,
+    2, 3, 1, 3, 2, 8, 4, 2, 2, 6, 1, 19, 1, 2, 3, 1,
+    3, 2, 1, 12, 1, 2, 3, 4, 1, 2, 3, 3, 4, 5, 1, 2,
+    1, 10, 1, 10, 1, 1, 2, 3, 2, 3, 1, 15, 1, 11, 1, 14,
+    1, 29, 1, 12, 1, 5, 1, 3, 1, 8, 1, 3, 1, 13, 1, 13,
+    1, 96, 1, 53, 12, 28, 1, 63, 1, 3, 15, 35, 1, 111, 1, 104,
+    1, 57, 1, 38, 1, 11, 1, 3, 1, 10, 1, 6, 1, 23, 1, 8,
+    1, 3, 1, 7, 2, 28, 1, 3, 1, 2, 1, 5, 1, 3, 7, 1,
+    2, 28, 1, 3, 3, 6, 3, 6, 2, 8, 4, 10, 4,
+};
+const rle2 rle_minuteWords_ten = {54, 27, RLE2_DELTA, 0, nullptr, runs_minuteWords_ten};
+
+// 120x33, 323 bytes, delta rows
+const uint8_t runs_minuteWords_eleven[] = {
+    25, 4, 146, 10, 7, 27, 7, 37, 7, 18, 6, 9, 2, 3, 1, 3,
+    2, 23, 2, 3, 1, 3, 2, 6, 4, 13, 2, 8, 2, 3, 1, 3,
+    2, 8, 4, 2, 2, 6, 1, 7, 1, 2, 3, 1, 3, 2, 1, 21,
+    1, 2, 3, 1, 3, 2, 1, 5, 1, 15, 1, 9, 1, 2, 3, 1,
+    3, 2, 1, 12, 1, 2, 3, 4, 1, 5, 1, 2, 1, 10, 1, 19,
+    1, 2, 1, 10, 1, 8, 1, 13, 1, 6, 1, 2, 1, 10, 1, 10,
+    1, 1, 2, 3, 2, 3, 1, 3, 1, 11, 1, 21, 1, 11, 1, 31,
+    1, 11, 1, 14, 1, 17, 1, 12, 1, 20, 1, 12, 1, 4, 1, 3,
+    1, 9, 1, 11, 1, 12, 1, 5, 1, 3, 1, 8, 1, 3, 1, 1,
+    1, 13, 1, 19, 1, 13, 1, 23, 1, 5, 1, 13, 1, 84, 1, 11,
+    1, 53, 1, 33, 1, 23, 1, 9, 1, 9, 1, 41, 12, 22, 12, 9,
+    1, 22, 12, 95, 1, 1, 1, 48, 1, 3, 15, 15, 1, 3, 15, 10,
+    1, 14, 1, 3, 15, 23, 1, 33, 1, 25, 1, 9, 1, 7, 1, 105,
+    1, 3, 1, 55, 1, 33, 1, 22, 1, 20, 1, 102, 1, 1, 1, 1,
+    1, 51, 1, 33, 1, 43, 1, 45, 1, 33, 1, 22, 1, 3, 1, 1,
+    1, 14, 1, 38, 1, 3, 1, 10, 1, 18, 1, 3, 1, 10, 1, 28,
+    1, 3, 1, 10, 1, 6, 1, 20, 1, 3, 1, 7, 2, 20, 1, 3,
+    1, 7, 2, 12, 1, 17, 1, 3, 1, 7, 2, 29, 1, 3, 7, 1,
+    2, 20, 1, 3, 7, 1, 2, 15, 1, 14, 1, 3, 7, 1, 2, 29,
+    3, 6, 2, 9, 4, 10, 3, 6, 2, 14, 3, 16, 3, 6, 2, 8,
+    4, 10, 4,
+};
+const rle2 rle_minuteWords_eleven = {120, 33, RLE2_DELTA, 0, nullptr, runs_minuteWords_eleven};
+
+// 121x33, 353 bytes, delta rows
+const uint8_t runs_minuteWords_twelve[] = {
+    71, 4, 144, 5, 1, 117, 3, 225, 3, 1, 50, 7, 49, 7, 5, 3,
+    3, 4, 2, 4, 11, 3, 11, 3, 7, 2, 3, 1, 3, 2, 18, 4,
+    13, 2, 8, 2, 3, 1, 3, 2, 29, 1, 13, 1, 2, 1, 6, 1,
+    2, 3, 1, 3, 2, 1, 17, 1, 15, 1, 9, 1, 2, 3, 1, 3,
+    2, 1, 2, 3, 3, 4, 2, 1, 36, 1, 2, 1, 10, 1, 20, 1,
+    13, 1, 6, 1, 2, 1, 10, 1, 17, 1, 25, 1, 5, 1, 11, 1,
+    43, 1, 11, 1, 17, 1, 11, 1, 4, 1, 8, 1, 11, 1, 12, 1,
+    16, 1, 3, 1, 9, 1, 11, 1, 12, 1, 27, 1, 13, 1, 5, 1,
+    13, 1, 35, 1, 5, 1, 13, 1, 20, 1, 13, 1, 50, 1, 11, 1,
+    40, 1, 9, 1, 1, 1, 1, 1, 9, 1, 1, 1, 9, 1, 35, 1,
+    9, 1, 9, 1, 64, 12, 21, 1, 22, 12, 5, 1, 12, 1, 2, 1,
+    6, 1, 6, 1, 4, 1, 1, 1, 53, 1, 1, 1, 48, 1, 5, 1,
+    16, 1, 3, 15, 22, 1, 14, 1, 3, 15, 19, 1, 26, 1, 37, 1,
+    9, 1, 7, 1, 34, 1, 7, 1, 8, 1, 2, 1, 1, 1, 49, 1,
+    3, 1, 50, 1, 7, 1, 19, 1, 34, 1, 20, 1, 34, 1, 14, 1,
+    1, 1, 51, 1, 1, 1, 1, 1, 44, 1, 3, 1, 1, 1, 10, 1,
+    12, 1, 55, 1, 48, 1, 4, 1, 14, 1, 34, 1, 3, 1, 1, 1,
+    14, 1, 15, 1, 45, 1, 3, 1, 10, 1, 40, 1, 3, 1, 10, 1,
+    7, 1, 11, 1, 3, 1, 26, 1, 3, 1, 7, 2, 24, 1, 17, 1,
+    3, 1, 7, 2, 5, 1, 3, 1, 2, 1, 21, 1, 2, 1, 14, 1,
+    3, 7, 1, 2, 27, 1, 14, 1, 3, 7, 1, 2, 5, 1, 3, 3,
+    8, 3, 11, 2, 16, 3, 6, 2, 9, 4, 13, 3, 16, 3, 6, 2,
+    3,
+};
+const rle2 rle_minuteWords_twelve = {121, 33, RLE2_DELTA, 0, nullptr, runs_minuteWords_twelve};
+
+// 138x33, 323 bytes, delta rows
+const uint8_t runs_minuteWords_thirteen[] = {
+    14, 4, 170, 2, 2, 135, 1, 1, 2, 1, 247, 1, 1, 128, 1, 1,
+    33, 4, 24, 1, 72, 3, 59, 3, 231, 3, 1, 19, 6, 29, 4, 3,
+    1, 16, 7, 15, 7, 18, 6, 4, 3, 3, 4, 10, 2, 6, 1, 10,
+    4, 7, 4, 2, 1, 3, 1, 1, 3, 3, 4, 7, 2, 3, 1, 3,
+    2, 11, 2, 3, 1, 3, 2, 8, 4, 2, 2, 6, 1, 22, 1, 2,
+    3, 4, 1, 25, 1, 22, 1, 2, 3, 1, 3, 2, 1, 9, 1, 2,
+    3, 1, 3, 2, 1, 12, 1, 2, 3, 4, 1, 2, 3, 3, 4, 8,
+    1, 1, 2, 3, 2, 3, 1, 23, 1, 2, 2, 3, 3, 3, 4, 5,
+    1, 2, 1, 10, 1, 7, 1, 2, 1, 10, 1, 10, 1, 1, 2, 3,
+    2, 3, 1, 20, 1, 35, 2, 2, 1, 16, 1, 11, 1, 9, 1, 11,
+    1, 14, 1, 30, 1, 8, 1, 3, 1, 47, 1, 12, 1, 8, 1, 12,
+    1, 5, 1, 3, 1, 8, 1, 3, 1, 54, 1, 20, 1, 13, 1, 7,
+    1, 13, 1, 242, 1, 1, 21, 1, 115, 12, 10, 12, 28, 1, 61, 1,
+    147, 1, 1, 3, 15, 3, 1, 3, 15, 97, 1, 21, 1, 129, 2, 1,
+    21, 1, 189, 1, 1, 60, 1, 21, 1, 119, 1, 21, 1, 38, 1, 61,
+    1, 11, 1, 3, 1, 10, 1, 6, 1, 3, 1, 10, 1, 6, 1, 23,
+    1, 61, 1, 8, 1, 3, 1, 7, 2, 8, 1, 3, 1, 7, 2, 28,
+    1, 3, 1, 2, 1, 54, 1, 3, 1, 2, 1, 5, 1, 3, 7, 1,
+    2, 8, 1, 3, 7, 1, 2, 28, 1, 3, 3, 3, 4, 10, 4, 7,
+    4, 7, 4, 12, 1, 3, 3, 6, 3, 6, 2, 11, 3, 6, 2, 8,
+    4, 10, 4,
+};
+const rle2 rle_minuteWords_thirteen = {138, 33, RLE2_DELTA, 0, nullptr, runs_minuteWords_thirteen};
+
+// 150x34, 397 bytes, delta rows
+const uint8_t runs_minuteWords_fourteen[] = {
+    9, 3, 145, 1, 2, 147, 1, 1, 148, 1, 1, 1, 4, 145, 1, 1,
+    4, 1, 142, 1, 1, 246, 2, 1, 73, 1, 72, 3, 157, 4, 6, 43,
+    4, 3, 1, 16, 7, 15, 7, 18, 6, 4, 3, 3, 4, 7, 3, 2,
+    2, 2, 3, 9, 4, 10, 4, 6, 4, 2, 1, 3, 1, 1, 3, 3,
+    4, 7, 2, 3, 1, 3, 2, 11, 2, 3, 1, 3, 2, 8, 4, 2,
+    2, 6, 1, 19, 1, 2, 3, 2, 3, 2, 1, 37, 1, 22, 1, 2,
+    3, 1, 3, 2, 1, 9, 1, 2, 3, 1, 3, 2, 1, 12, 1, 2,
+    3, 4, 1, 2, 3, 3, 4, 5, 1, 2, 1, 8, 1, 2, 1, 35,
+    1, 2, 2, 3, 3, 3, 4, 5, 1, 2, 1, 10, 1, 7, 1, 2,
+    1, 10, 1, 10, 1, 1, 2, 3, 2, 3, 1, 15, 1, 16, 1, 23,
+    1, 11, 2, 2, 1, 16, 1, 11, 1, 9, 1, 11, 1, 14, 1, 29,
+    1, 10, 1, 62, 1, 12, 1, 8, 1, 12, 1, 5, 1, 3, 1, 8,
+    1, 3, 1, 13, 1, 18, 1, 33, 1, 20, 1, 13, 1, 7, 1, 13,
+    1, 192, 1, 1, 24, 1, 48, 1, 21, 1, 66, 1, 60, 12, 10, 12,
+    38, 1, 63, 1, 159, 1, 1, 3, 15, 3, 1, 3, 15, 35, 1, 73,
+    1, 21, 1, 70, 1, 136, 1, 1, 24, 1, 48, 1, 21, 1, 200, 1,
+    1, 18, 1, 18, 1, 35, 1, 21, 1, 57, 1, 10, 1, 9, 1, 52,
+    1, 21, 1, 50, 1, 16, 1, 10, 1, 7, 1, 25, 1, 11, 1, 3,
+    1, 10, 1, 6, 1, 3, 1, 10, 1, 6, 1, 32, 1, 2, 1, 8,
+    1, 2, 1, 8, 1, 3, 2, 3, 2, 1, 1, 28, 1, 8, 1, 3,
+    1, 7, 2, 8, 1, 3, 1, 7, 2, 27, 1, 13, 1, 2, 3, 2,
+    3, 2, 1, 10, 1, 4, 3, 2, 1, 4, 1, 21, 1, 3, 1, 2,
+    1, 5, 1, 3, 7, 1, 2, 8, 1, 3, 7, 1, 2, 26, 4, 11,
+    3, 2, 2, 3, 2, 12, 1, 6, 2, 2, 4, 6, 4, 12, 1, 3,
+    3, 6, 3, 6, 2, 11, 3, 6, 2, 8, 4, 10, 4,
+};
+const rle2 rle_minuteWords_fourteen = {150, 34, RLE2_DELTA, 0, nullptr, runs_minuteWords_fourteen};
+
+// 112x34, 289 bytes, delta rows
+const uint8_t runs_minuteWords_fifteen[] = {
+    9, 3, 21, 3, 83, 2, 22, 2, 85, 1, 23, 1, 86, 1, 1, 4,
+    5, 2, 11, 1, 1, 4, 83, 1, 4, 1, 3, 1, 2, 1, 11, 1,
+    4, 1, 80, 1, 23, 1, 210, 1, 4, 22, 1, 73, 1, 23, 1, 10,
+    3, 189, 3, 1, 16, 7, 15, 7, 18, 6, 4, 3, 3, 4, 5, 4,
+    5, 3, 3, 4, 2, 3, 3, 4, 7, 2, 3, 1, 3, 2, 11, 2,
+    3, 1, 3, 2, 8, 4, 2, 2, 6, 1, 55, 1, 2, 3, 1, 3,
+    2, 1, 9, 1, 2, 3, 1, 3, 2, 1, 12, 1, 2, 3, 4, 1,
+    2, 3, 3, 4, 14, 3, 3, 4, 2, 3, 3, 4, 5, 1, 2, 1,
+    10, 1, 7, 1, 2, 1, 10, 1, 10, 1, 1, 2, 3, 2, 3, 1,
+    51, 1, 11, 1, 9, 1, 11, 1, 14, 1, 65, 1, 12, 1, 8, 1,
+    12, 1, 5, 1, 3, 1, 8, 1, 3, 1, 49, 1, 13, 1, 7, 1,
+    13, 1, 190, 1, 1, 21, 1, 89, 12, 10, 12, 64, 1, 121, 1, 3,
+    15, 3, 1, 3, 15, 71, 1, 21, 1, 205, 1, 1, 21, 1, 198, 1,
+    1, 21, 1, 93, 1, 21, 1, 74, 1, 11, 1, 3, 1, 10, 1, 6,
+    1, 3, 1, 10, 1, 6, 1, 59, 1, 8, 1, 3, 1, 7, 2, 8,
+    1, 3, 1, 7, 2, 27, 1, 23, 1, 12, 1, 3, 1, 2, 1, 5,
+    1, 3, 7, 1, 2, 8, 1, 3, 7, 1, 2, 26, 4, 9, 4, 7,
+    4, 10, 1, 3, 3, 6, 3, 6, 2, 11, 3, 6, 2, 8, 4, 10,
+    4,
+};
+const rle2 rle_minuteWords_fifteen = {112, 34, RLE2_DELTA, 0, nullptr, runs_minuteWords_fifteen};
+
+// 126x31, 402 bytes, delta rows
+const uint8_t runs_minuteWords_sixteen[] = {
+    20, 2, 123, 1, 2, 1, 246, 2, 4, 32, 1, 122, 3, 197, 3, 6,
+    42, 1, 16, 7, 15, 7, 18, 6, 6, 2, 6, 2, 7, 4, 5, 5,
+    11, 3, 3, 3, 3, 4, 7, 2, 3, 1, 3, 2, 11, 2, 3, 1,
+    3, 2, 8, 4, 2, 2, 6, 1, 4, 1, 2, 5, 2, 1, 16, 1,
+    4, 1, 9, 1, 2, 1, 19, 1, 2, 3, 1, 3, 2, 1, 9, 1,
+    2, 3, 1, 3, 2, 1, 12, 1, 2, 3, 4, 1, 5, 1, 5, 1,
+    19, 1, 12, 1, 2, 1, 4, 3, 3, 4, 5, 1, 2, 1, 10, 1,
+    7, 1, 2, 1, 10, 1, 10, 1, 1, 2, 3, 2, 3, 1, 1, 1,
+    9, 1, 19, 1, 3, 1, 6, 1, 2, 1, 19, 1, 11, 1, 9, 1,
+    11, 1, 14, 1, 43, 1, 3, 1, 7, 1, 23, 1, 12, 1, 8, 1,
+    12, 1, 5, 1, 3, 1, 8, 1, 3, 1, 40, 1, 1, 1, 20, 1,
+    13, 1, 7, 1, 13, 1, 29, 1, 28, 1, 3, 1, 2, 1, 1, 1,
+    88, 1, 28, 1, 3, 2, 1, 1, 25, 1, 21, 1, 37, 1, 4, 3,
+    26, 1, 31, 12, 10, 12, 34, 2, 29, 1, 12, 1, 74, 2, 7, 2,
+    23, 1, 3, 1, 22, 1, 3, 15, 3, 1, 3, 15, 26, 3, 6, 1,
+    22, 1, 4, 1, 21, 1, 21, 1, 47, 2, 26, 1, 1, 2, 3, 1,
+    92, 1, 24, 1, 4, 1, 27, 1, 21, 1, 46, 1, 25, 1, 6, 1,
+    115, 1, 1, 1, 4, 1, 3, 1, 19, 1, 21, 1, 71, 1, 1, 1,
+    6, 1, 3, 1, 22, 1, 21, 1, 36, 2, 10, 1, 17, 1, 21, 1,
+    11, 1, 3, 1, 10, 1, 6, 1, 3, 1, 10, 1, 6, 1, 19, 1,
+    6, 1, 1, 1, 17, 1, 2, 1, 8, 1, 3, 1, 10, 1, 8, 1,
+    3, 1, 7, 2, 8, 1, 3, 1, 7, 2, 28, 6, 1, 1, 17, 1,
+    2, 1, 10, 1, 3, 1, 6, 1, 3, 1, 2, 1, 5, 1, 3, 7,
+    1, 2, 8, 1, 3, 7, 1, 2, 24, 2, 6, 2, 9, 4, 5, 3,
+    12, 4, 7, 1, 3, 3, 6, 3, 6, 2, 11, 3, 6, 2, 8, 4,
+    10, 4,
+};
+const rle2 rle_minuteWords_sixteen = {126, 31, RLE2_DELTA, 0, nullptr, runs_minuteWords_sixteen};
+
+// 182x27, 525 bytes, delta rows
+const uint8_t runs_minuteWords_seventeen[] = {
+    111, 1, 178, 1, 3, 237, 4, 6, 13, 7, 37, 7, 18, 6, 10, 1,
+    16, 7, 15, 7, 18, 6, 6, 2, 6, 2, 9, 2, 3, 1, 3, 2,
+    6, 4, 13, 2, 8, 2, 3, 1, 3, 2, 8, 4, 2, 2, 6, 1,
+    7, 3, 3, 4, 7, 2, 3, 1, 3, 2, 11, 2, 3, 1, 3, 2,
+    8, 4, 2, 2, 6, 1, 4, 1, 2, 5, 2, 1, 8, 1, 2, 3,
+    1, 3, 2, 1, 5, 1, 15, 1, 9, 1, 2, 3, 1, 3, 2, 1,
+    12, 1, 2, 3, 4, 1, 22, 1, 2, 3, 1, 3, 2, 1, 9, 1,
+    2, 3, 1, 3, 2, 1, 12, 1, 2, 3, 4, 1, 5, 1, 5, 1,
+    9, 1, 2, 1, 10, 1, 8, 1, 13, 1, 6, 1, 2, 1, 10, 1,
+    10, 1, 1, 2, 3, 2, 3, 1, 5, 3, 3, 4, 5, 1, 2, 1,
+    10, 1, 7, 1, 2, 1, 10, 1, 10, 1, 1, 2, 3, 2, 3, 1,
+    1, 1, 9, 1, 7, 1, 11, 1, 31, 1, 11, 1, 14, 1, 30, 1,
+    11, 1, 9, 1, 11, 1, 14, 1, 33, 1, 12, 1, 4, 1, 3, 1,
+    9, 1, 11, 1, 12, 1, 5, 1, 3, 1, 8, 1, 3, 1, 21, 1,
+    12, 1, 8, 1, 12, 1, 5, 1, 3, 1, 8, 1, 3, 1, 17, 1,
+    13, 1, 23, 1, 5, 1, 13, 1, 43, 1, 13, 1, 7, 1, 13, 1,
+    29, 1, 36, 1, 11, 1, 133, 1, 1, 15, 1, 23, 1, 9, 1, 9,
+    1, 57, 1, 21, 1, 37, 1, 4, 3, 12, 12, 9, 1, 22, 12, 46,
+    12, 10, 12, 34, 2, 41, 1, 1, 1, 54, 1, 74, 2, 7, 2, 4,
+    1, 3, 15, 10, 1, 14, 1, 3, 15, 39, 1, 3, 15, 3, 1, 3,
+    15, 26, 3, 6, 1, 3, 1, 25, 1, 9, 1, 7, 1, 57, 1, 21,
+    1, 47, 2, 38, 1, 3, 1, 139, 1, 1, 11, 1, 22, 1, 20, 1,
+    57, 1, 21, 1, 46, 1, 37, 1, 1, 1, 1, 1, 147, 1, 1, 43,
+    1, 57, 1, 21, 1, 61, 1, 22, 1, 3, 1, 1, 1, 14, 1, 57,
+    1, 21, 1, 36, 2, 10, 1, 5, 1, 3, 1, 10, 1, 28, 1, 3,
+    1, 10, 1, 6, 1, 23, 1, 11, 1, 3, 1, 10, 1, 6, 1, 3,
+    1, 10, 1, 6, 1, 19, 1, 6, 1, 1, 1, 7, 1, 3, 1, 7,
+    2, 12, 1, 17, 1, 3, 1, 7, 2, 35, 1, 8, 1, 3, 1, 7,
+    2, 8, 1, 3, 1, 7, 2, 28, 6, 1, 1, 9, 1, 3, 7, 1,
+    2, 15, 1, 14, 1, 3, 7, 1, 2, 31, 1, 3, 1, 2, 1, 5,
+    1, 3, 7, 1, 2, 8, 1, 3, 7, 1, 2, 24, 2, 6, 2, 11,
+    3, 6, 2, 14, 3, 16, 3, 6, 2, 8, 4, 10, 4, 8, 1, 3,
+    3, 6, 3, 6, 2, 11, 3, 6, 2, 8, 4, 10, 4,
+};
+const rle2 rle_minuteWords_seventeen = {182, 27, RLE2_DELTA, 0, nullptr, runs_minuteWords_seventeen};
+
+// 156x44, 484 bytes, delta rows
+const uint8_t runs_minuteWords_eighteen[] = {
+    58, 4, 148, 2, 2, 153, 1, 1, 2, 1, 213, 2, 1, 122, 4, 56,
+    1, 152, 1, 3, 162, 4, 7, 26, 13, 13, 6, 10, 1, 16, 7, 15,
+    7, 18, 6, 9, 2, 3, 1, 3, 2, 9, 4, 9, 2, 2, 3, 4,
+    3, 12, 2, 6, 1, 7, 3, 3, 4, 7, 2, 3, 1, 3, 2, 11,
+    2, 3, 1, 3, 2, 8, 4, 2, 2, 6, 1, 7, 1, 2, 3, 1,
+    3, 2, 1, 20, 1, 2, 2, 3, 2, 2, 1, 2, 1, 10, 1, 2,
+    3, 4, 1, 22, 1, 2, 3, 1, 3, 2, 1, 9, 1, 2, 3, 1,
+    3, 2, 1, 12, 1, 2, 3, 4, 1, 5, 1, 2, 1, 10, 1, 18,
+    1, 2, 1, 10, 1, 11, 1, 1, 2, 3, 2, 3, 1, 5, 3, 3,
+    4, 5, 1, 2, 1, 10, 1, 7, 1, 2, 1, 10, 1, 10, 1, 1,
+    2, 3, 2, 3, 1, 3, 1, 11, 1, 32, 1, 15, 1, 30, 1, 11,
+    1, 9, 1, 11, 1, 14, 1, 17, 1, 12, 1, 16, 1, 26, 1, 8,
+    1, 3, 1, 21, 1, 12, 1, 8, 1, 12, 1, 5, 1, 3, 1, 8,
+    1, 3, 1, 1, 1, 13, 1, 77, 1, 13, 1, 7, 1, 13, 1, 186,
+    1, 1, 91, 1, 21, 1, 41, 12, 80, 12, 10, 12, 61, 1, 11, 1,
+    34, 1, 73, 1, 3, 15, 17, 1, 2, 1, 10, 1, 41, 1, 3, 15,
+    3, 1, 3, 15, 23, 1, 36, 1, 2, 1, 4, 2, 2, 1, 42, 1,
+    21, 1, 79, 1, 2, 4, 2, 2, 111, 1, 33, 1, 1, 7, 49, 1,
+    21, 1, 74, 1, 1, 1, 117, 1, 34, 1, 21, 1, 34, 1, 21, 1,
+    45, 1, 91, 1, 21, 1, 38, 1, 3, 1, 10, 1, 21, 8, 35, 1,
+    11, 1, 3, 1, 10, 1, 6, 1, 3, 1, 10, 1, 6, 1, 20, 1,
+    3, 1, 7, 2, 19, 1, 10, 4, 35, 1, 8, 1, 3, 1, 7, 2,
+    8, 1, 3, 1, 7, 2, 29, 1, 3, 7, 1, 2, 19, 1, 13, 1,
+    31, 1, 3, 1, 2, 1, 5, 1, 3, 7, 1, 2, 8, 1, 3, 7,
+    1, 2, 29, 3, 6, 2, 9, 4, 8, 1, 2, 8, 4, 1, 5, 4,
+    10, 4, 8, 1, 3, 3, 6, 3, 6, 2, 11, 3, 6, 2, 8, 4,
+    10, 4, 8, 6, 22, 1, 2, 1, 8, 1, 36, 5, 10, 6, 16, 6,
+    63, 1, 2, 1, 10, 1, 3, 1, 139, 1, 1, 152, 1, 1, 18, 1,
+    192, 3, 1, 2, 1, 14, 1, 152, 1, 1, 141, 1, 1, 2, 1, 9,
+    1, 2, 1, 140, 1, 1, 2, 2, 4, 3, 1, 2, 142, 1, 3, 1,
+    4, 2, 2, 107,
+};
+const rle2 rle_minuteWords_eighteen = {156, 44, RLE2_DELTA, 0, nullptr, runs_minuteWords_eighteen};
+
+// 156x31, 380 bytes, delta rows
+const uint8_t runs_minuteWords_nineteen[] = {
+    26, 2, 153, 1, 1, 2, 1, 208, 3, 4, 56, 1, 152, 1, 3, 163,
+    4, 6, 30, 6, 15, 7, 10, 1, 16, 7, 15, 7, 18, 6, 4, 4,
+    2, 2, 6, 1, 10, 4, 7, 4, 2, 2, 6, 1, 12, 2, 3, 1,
+    3, 2, 6, 3, 3, 4, 7, 2, 3, 1, 3, 2, 11, 2, 3, 1,
+    3, 2, 8, 4, 2, 2, 6, 1, 8, 1, 2, 3, 4, 1, 25, 1,
+    2, 3, 4, 1, 10, 1, 2, 3, 1, 3, 2, 1, 21, 1, 2, 3,
+    1, 3, 2, 1, 9, 1, 2, 3, 1, 3, 2, 1, 12, 1, 2, 3,
+    4, 1, 6, 1, 1, 2, 3, 2, 3, 1, 23, 1, 1, 2, 3, 2,
+    3, 1, 8, 1, 2, 1, 10, 1, 4, 3, 3, 4, 5, 1, 2, 1,
+    10, 1, 7, 1, 2, 1, 10, 1, 10, 1, 1, 2, 3, 2, 3, 1,
+    6, 1, 35, 1, 18, 1, 11, 1, 21, 1, 11, 1, 9, 1, 11, 1,
+    14, 1, 12, 1, 3, 1, 8, 1, 3, 1, 18, 1, 3, 1, 8, 1,
+    3, 1, 9, 1, 12, 1, 20, 1, 12, 1, 8, 1, 12, 1, 5, 1,
+    3, 1, 8, 1, 3, 1, 59, 1, 13, 1, 19, 1, 13, 1, 7, 1,
+    13, 1, 244, 1, 1, 33, 1, 21, 1, 99, 12, 22, 12, 10, 12, 108,
+    1, 131, 1, 1, 3, 15, 15, 1, 3, 15, 3, 1, 3, 15, 81, 1,
+    33, 1, 21, 1, 131, 2, 1, 33, 1, 21, 1, 252, 1, 1, 33, 1,
+    21, 1, 103, 1, 33, 1, 21, 1, 36, 1, 35, 1, 23, 1, 3, 1,
+    10, 1, 6, 1, 11, 1, 3, 1, 10, 1, 6, 1, 3, 1, 10, 1,
+    6, 1, 78, 1, 3, 1, 7, 2, 11, 1, 8, 1, 3, 1, 7, 2,
+    8, 1, 3, 1, 7, 2, 87, 1, 3, 7, 1, 2, 7, 1, 3, 1,
+    2, 1, 5, 1, 3, 7, 1, 2, 8, 1, 3, 7, 1, 2, 24, 4,
+    10, 4, 7, 4, 7, 4, 10, 4, 9, 3, 6, 2, 10, 1, 3, 3,
+    6, 3, 6, 2, 11, 3, 6, 2, 8, 4, 10, 4,
+};
+const rle2 rle_minuteWords_nineteen = {156, 31, RLE2_DELTA, 0, nullptr, runs_minuteWords_nineteen};
+
+// 44x33, 122 bytes, delta rows
+const uint8_t runs_decadeWords_oh[] = {
+    26, 4, 216, 1, 1, 245, 1, 6, 20, 6, 9, 3, 2, 2, 2, 3,
+    15, 2, 6, 1, 7, 1, 2, 3, 2, 3, 2, 1, 13, 1, 2, 3,
+    4, 1, 5, 1, 2, 1, 8, 1, 2, 1, 11, 1, 1, 2, 3, 2,
+    3, 1, 3, 1, 16, 1, 11, 1, 17, 1, 10, 1, 13, 1, 8, 1,
+    3, 1, 1, 1, 18, 1, 71, 1, 56, 1, 26, 1, 87, 1, 60, 1,
+    30, 1, 84, 1, 18, 1, 5, 1, 22, 1, 10, 1, 29, 1, 16, 1,
+    27, 1, 2, 1, 8, 1, 2, 1, 29, 1, 2, 3, 2, 3, 2, 1,
+    31, 3, 2, 2, 3, 2, 9, 4, 10, 4,
+};
+const rle2 rle_decadeWords_oh = {44, 33, RLE2_DELTA, 0, nullptr, runs_decadeWords_oh};
+
+// 123x38, 372 bytes, delta rows
+const uint8_t runs_decadeWords_twenty[] = {
+    5, 1, 91, 1, 27, 3, 89, 3, 141, 3, 1, 50, 7, 18, 6, 10,
+    1, 28, 3, 3, 4, 2, 4, 11, 3, 11, 3, 7, 2, 3, 1, 3,
+    2, 8, 4, 2, 2, 6, 1, 7, 3, 3, 4, 2, 4, 13, 2, 26,
+    1, 13, 1, 2, 1, 6, 1, 2, 3, 1, 3, 2, 1, 12, 1, 2,
+    3, 4, 1, 18, 1, 15, 1, 2, 3, 3, 4, 2, 1, 36, 1, 2,
+    1, 10, 1, 10, 1, 1, 2, 3, 2, 3, 1, 5, 3, 3, 4, 6,
+    1, 13, 1, 16, 1, 25, 1, 5, 1, 11, 1, 14, 1, 60, 1, 11,
+    1, 4, 1, 8, 1, 11, 1, 12, 1, 5, 1, 3, 1, 8, 1, 3,
+    1, 17, 1, 13, 1, 1, 1, 28, 1, 13, 1, 5, 1, 13, 1, 47,
+    1, 30, 1, 13, 1, 74, 1, 11, 1, 18, 1, 9, 1, 1, 1, 1,
+    1, 9, 1, 1, 1, 9, 1, 59, 1, 9, 1, 52, 12, 45, 1, 17,
+    1, 12, 1, 2, 1, 6, 1, 6, 1, 4, 1, 1, 1, 54, 1, 22,
+    1, 1, 1, 26, 1, 5, 1, 16, 1, 3, 15, 46, 1, 30, 1, 26,
+    1, 61, 1, 9, 1, 20, 1, 7, 1, 8, 1, 2, 1, 1, 1, 73,
+    1, 3, 1, 28, 1, 7, 1, 19, 1, 58, 1, 7, 1, 25, 1, 14,
+    1, 1, 1, 77, 1, 24, 1, 3, 1, 1, 1, 10, 1, 12, 1, 65,
+    1, 40, 1, 4, 1, 14, 1, 58, 1, 3, 1, 1, 1, 8, 1, 45,
+    1, 3, 1, 10, 1, 6, 1, 23, 1, 34, 1, 11, 1, 3, 1, 26,
+    1, 3, 1, 7, 2, 35, 1, 12, 1, 3, 1, 10, 1, 3, 1, 2,
+    1, 21, 1, 2, 1, 14, 1, 3, 7, 1, 2, 31, 1, 3, 1, 2,
+    1, 24, 1, 3, 3, 8, 3, 11, 2, 16, 3, 6, 2, 8, 4, 10,
+    4, 8, 1, 3, 3, 11, 1, 13, 5, 44, 6, 37, 5, 134, 1, 1,
+    120, 1, 244, 1, 1, 1, 1, 242, 1, 1, 1, 1, 242, 1, 1, 124,
+    1, 119, 1, 15,
+};
+const rle2 rle_decadeWords_twenty = {123, 38, RLE2_DELTA, 0, nullptr, runs_decadeWords_twenty};
+
+// 93x44, 225 bytes, delta rows
+const uint8_t runs_decadeWords_thirty[] = {
+    14, 4, 208, 1, 2, 90, 1, 2, 1, 157, 1, 1, 83, 1, 33, 4,
+    24, 1, 27, 3, 59, 3, 179, 2, 1, 19, 6, 29, 4, 3, 1, 28,
+    3, 3, 4, 10, 2, 6, 1, 10, 4, 7, 4, 2, 1, 3, 1, 1,
+    3, 3, 4, 2, 4, 13, 2, 19, 1, 2, 3, 4, 1, 25, 1, 18,
+    1, 15, 1, 2, 3, 3, 4, 8, 1, 1, 2, 3, 2, 3, 1, 23,
+    1, 2, 2, 3, 3, 3, 4, 6, 1, 13, 1, 19, 1, 35, 2, 2,
+    1, 51, 1, 8, 1, 3, 1, 43, 1, 13, 1, 1, 1, 55, 1, 24,
+    1, 89, 1, 11, 1, 84, 1, 9, 1, 79, 1, 17, 1, 61, 1, 22,
+    1, 1, 1, 84, 1, 89, 1, 9, 1, 86, 1, 3, 1, 85, 1, 7,
+    1, 90, 1, 21, 1, 68, 1, 89, 1, 3, 1, 1, 1, 8, 1, 61,
+    1, 34, 1, 61, 1, 12, 1, 3, 1, 10, 1, 3, 1, 2, 1, 54,
+    1, 3, 1, 2, 1, 24, 1, 3, 3, 3, 4, 10, 4, 7, 4, 7,
+    4, 12, 1, 3, 3, 11, 1, 13, 5, 57, 5, 104, 1, 90, 1, 184,
+    1, 1, 1, 1, 182, 1, 1, 1, 1, 182, 1, 1, 94, 1, 89, 1,
+    15,
+};
+const rle2 rle_decadeWords_thirty = {93, 44, RLE2_DELTA, 0, nullptr, runs_decadeWords_thirty};
+
+// 81x45, 256 bytes, delta rows
+const uint8_t runs_decadeWords_forty[] = {
+    9, 3, 76, 2, 78, 1, 79, 1, 1, 4, 76, 1, 4, 1, 73, 1,
+    212, 1, 1, 28, 1, 48, 3, 161, 2, 6, 19, 4, 3, 1, 28, 3,
+    3, 4, 7, 3, 2, 2, 2, 3, 9, 4, 2, 1, 3, 1, 1, 3,
+    3, 4, 2, 4, 13, 2, 16, 1, 2, 3, 2, 3, 2, 1, 13, 1,
+    18, 1, 15, 1, 2, 3, 3, 4, 5, 1, 2, 1, 8, 1, 2, 1,
+    11, 1, 2, 2, 3, 3, 3, 4, 6, 1, 13, 1, 14, 1, 16, 1,
+    11, 2, 2, 1, 50, 1, 10, 1, 34, 1, 13, 1, 1, 1, 14, 1,
+    18, 1, 9, 1, 24, 1, 77, 1, 11, 1, 20, 1, 51, 1, 9, 1,
+    31, 1, 35, 1, 27, 1, 39, 1, 22, 1, 1, 1, 72, 1, 23, 1,
+    53, 1, 9, 1, 33, 1, 40, 1, 3, 1, 22, 1, 50, 1, 7, 1,
+    78, 1, 20, 1, 18, 1, 38, 1, 26, 1, 10, 1, 39, 1, 3, 1,
+    1, 1, 20, 1, 16, 1, 20, 1, 43, 1, 2, 1, 8, 1, 2, 1,
+    25, 1, 12, 1, 3, 1, 9, 1, 13, 1, 2, 3, 2, 3, 2, 1,
+    23, 1, 3, 1, 2, 1, 22, 4, 11, 3, 2, 2, 3, 2, 9, 4,
+    12, 1, 3, 3, 11, 1, 28, 7, 28, 5, 92, 1, 78, 1, 160, 1,
+    1, 1, 1, 158, 1, 1, 1, 1, 158, 1, 1, 82, 1, 77, 1, 15,
+};
+const rle2 rle_decadeWords_forty = {81, 45, RLE2_DELTA, 0, nullptr, runs_decadeWords_forty};
+
+// 67x45, 191 bytes, delta rows
+const uint8_t runs_decadeWords_fifty[] = {
+    9, 3, 21, 3, 38, 2, 22, 2, 40, 1, 23, 1, 41, 1, 1, 4,
+    5, 2, 11, 1, 1, 4, 38, 1, 4, 1, 3, 1, 2, 1, 11, 1,
+    4, 1, 35, 1, 23, 1, 120, 4, 22, 1, 28, 1, 23, 1, 10, 3,
+    137, 2, 1, 28, 3, 3, 4, 5, 4, 5, 3, 3, 4, 2, 3, 3,
+    4, 2, 4, 13, 2, 48, 1, 15, 1, 2, 3, 3, 4, 14, 3, 3,
+    4, 2, 3, 3, 4, 6, 1, 13, 1, 116, 1, 13, 1, 1, 1, 54,
+    1, 63, 1, 11, 1, 58, 1, 9, 1, 53, 1, 53, 1, 22, 1, 1,
+    1, 58, 1, 63, 1, 9, 1, 60, 1, 3, 1, 59, 1, 7, 1, 64,
+    1, 64, 1, 63, 1, 3, 1, 1, 1, 44, 1, 70, 1, 12, 1, 3,
+    1, 9, 1, 23, 1, 12, 1, 3, 1, 2, 1, 22, 4, 9, 4, 7,
+    4, 10, 1, 3, 3, 11, 1, 49, 5, 78, 1, 64, 1, 132, 1, 1,
+    1, 1, 130, 1, 1, 1, 1, 130, 1, 1, 68, 1, 63, 1, 15,
+};
+const rle2 rle_decadeWords_fifty = {67, 45, RLE2_DELTA, 0, nullptr, runs_decadeWords_fifty};
+
+// 136x33, 383 bytes, delta rows
+const uint8_t runs_onTheHourWords_o_clock[] = {
+    61, 4, 53, 4, 178, 1, 2, 240, 3, 1, 193, 5, 6, 30, 8, 26,
+    6, 18, 8, 31, 3, 2, 2, 2, 3, 25, 2, 3, 2, 3, 2, 21,
+    3, 2, 2, 2, 3, 13, 2, 3, 2, 3, 2, 19, 4, 5, 1, 2,
+    3, 2, 3, 2, 1, 22, 2, 2, 3, 2, 2, 23, 1, 2, 3, 2,
+    3, 2, 1, 10, 2, 2, 3, 2, 2, 25, 1, 4, 1, 2, 1, 8,
+    1, 2, 1, 9, 2, 9, 1, 3, 1, 7, 1, 21, 1, 2, 1, 8,
+    1, 2, 1, 8, 1, 3, 1, 7, 1, 20, 1, 2, 1, 4, 1, 16,
+    1, 22, 1, 9, 1, 19, 1, 16, 1, 10, 1, 9, 1, 18, 1, 1,
+    2, 8, 1, 10, 1, 21, 1, 14, 1, 21, 1, 10, 1, 9, 1, 14,
+    1, 16, 1, 1, 1, 6, 1, 18, 1, 20, 1, 29, 1, 18, 1, 8,
+    1, 27, 1, 1, 1, 43, 1, 57, 1, 30, 1, 1, 1, 11, 1, 69,
+    1, 50, 1, 1, 1, 25, 1, 69, 1, 35, 2, 1, 1, 9, 1, 69,
+    1, 51, 1, 3, 1, 131, 1, 1, 13, 1, 69, 1, 52, 1, 3, 1,
+    25, 1, 69, 1, 36, 1, 3, 1, 11, 1, 69, 1, 50, 1, 3, 1,
+    132, 1, 1, 3, 1, 6, 1, 18, 1, 16, 1, 3, 1, 29, 1, 18,
+    1, 4, 1, 3, 1, 18, 1, 8, 1, 3, 1, 9, 1, 10, 1, 37,
+    1, 20, 1, 10, 1, 25, 1, 15, 1, 3, 1, 5, 1, 16, 1, 18,
+    1, 3, 1, 10, 1, 18, 1, 16, 1, 6, 1, 3, 1, 10, 1, 21,
+    1, 5, 1, 2, 1, 8, 1, 2, 1, 20, 1, 3, 2, 6, 2, 1,
+    1, 18, 1, 2, 1, 8, 1, 2, 1, 8, 1, 3, 2, 6, 2, 1,
+    1, 16, 1, 4, 1, 5, 1, 2, 3, 2, 3, 2, 1, 22, 2, 3,
+    6, 2, 1, 20, 1, 2, 3, 2, 3, 2, 1, 10, 2, 3, 6, 2,
+    1, 18, 1, 4, 1, 5, 3, 2, 2, 3, 2, 25, 2, 6, 3, 8,
+    4, 10, 3, 2, 2, 3, 2, 13, 2, 6, 3, 7, 4, 9, 5,
+};
+const rle2 rle_onTheHourWords_o_clock = {136, 33, RLE2_DELTA, 0, nullptr, runs_onTheHourWords_o_clock};
+
+// 90x22, 243 bytes, delta rows
+const uint8_t runs_onTheHourWords_noon[] = {
+    8, 6, 16, 6, 18, 6, 20, 6, 4, 4, 2, 2, 6, 1, 12, 3,
+    2, 2, 2, 3, 12, 3, 2, 2, 2, 3, 9, 4, 2, 2, 6, 1,
+    8, 1, 2, 3, 4, 1, 10, 1, 2, 3, 2, 3, 2, 1, 10, 1,
+    2, 3, 2, 3, 2, 1, 13, 1, 2, 3, 4, 1, 6, 1, 1, 2,
+    3, 2, 3, 1, 8, 1, 2, 1, 8, 1, 2, 1, 8, 1, 2, 1,
+    8, 1, 2, 1, 11, 1, 1, 2, 3, 2, 3, 1, 6, 1, 18, 1,
+    16, 1, 6, 1, 16, 1, 11, 1, 12, 1, 3, 1, 8, 1, 3, 1,
+    9, 1, 10, 1, 12, 1, 10, 1, 9, 1, 3, 1, 8, 1, 3, 1,
+    23, 1, 18, 1, 4, 1, 18, 1, 139, 1, 1, 23, 1, 78, 1, 23,
+    1, 48, 1, 23, 1, 155, 1, 1, 23, 1, 82, 1, 23, 1, 52, 1,
+    23, 1, 152, 1, 1, 18, 1, 4, 1, 18, 1, 50, 1, 10, 1, 12,
+    1, 10, 1, 27, 1, 23, 1, 16, 1, 6, 1, 16, 1, 6, 1, 42,
+    1, 2, 1, 8, 1, 2, 1, 8, 1, 2, 1, 8, 1, 2, 1, 51,
+    1, 2, 3, 2, 3, 2, 1, 10, 1, 2, 3, 2, 3, 2, 1, 26,
+    4, 10, 4, 9, 3, 2, 2, 3, 2, 12, 3, 2, 2, 3, 2, 9,
+    4, 10, 4,
+};
+const rle2 rle_onTheHourWords_noon = {90, 22, RLE2_DELTA, 0, nullptr, runs_onTheHourWords_noon};
+
+// 163x44, 392 bytes, delta rows
+const uint8_t runs_onTheHourWords_midnight[] = {
+    63, 3, 64, 4, 230, 1, 2, 58, 2, 100, 1, 2, 1, 56, 1, 2,
+    1, 227, 2, 1, 69, 4, 56, 4, 56, 1, 159, 1, 3, 246, 3, 6,
+    7, 6, 27, 6, 21, 6, 26, 13, 13, 6, 10, 1, 8, 4, 2, 1,
+    6, 1, 5, 1, 6, 2, 9, 4, 10, 2, 6, 2, 11, 4, 2, 2,
+    6, 1, 10, 4, 9, 2, 2, 3, 4, 3, 12, 2, 6, 1, 7, 3,
+    3, 4, 6, 1, 2, 2, 4, 1, 3, 1, 1, 3, 5, 1, 21, 1,
+    3, 6, 1, 1, 15, 1, 2, 3, 4, 1, 21, 1, 2, 2, 3, 2,
+    2, 1, 2, 1, 10, 1, 2, 3, 4, 1, 21, 4, 2, 2, 3, 1,
+    1, 3, 3, 2, 24, 1, 3, 1, 6, 1, 15, 1, 1, 2, 3, 2,
+    3, 1, 19, 1, 2, 1, 10, 1, 11, 1, 1, 2, 3, 2, 3, 1,
+    5, 3, 3, 4, 13, 1, 3, 2, 7, 1, 3, 1, 18, 1, 3, 1,
+    8, 2, 14, 1, 41, 1, 15, 1, 31, 1, 67, 1, 3, 1, 8, 1,
+    3, 1, 17, 1, 26, 1, 8, 1, 3, 1, 62, 1, 3, 1, 173, 1,
+    1, 149, 4, 1, 11, 1, 34, 1, 116, 1, 2, 1, 10, 1, 149, 1,
+    1, 2, 1, 4, 2, 2, 1, 151, 1, 1, 2, 4, 2, 2, 104, 1,
+    47, 1, 1, 7, 153, 1, 1, 1, 1, 98, 1, 60, 1, 21, 1, 83,
+    1, 9, 1, 149, 1, 1, 13, 1, 9, 1, 38, 8, 35, 1, 57, 1,
+    2, 2, 5, 3, 46, 1, 10, 4, 35, 1, 54, 1, 3, 5, 1, 1,
+    48, 1, 13, 1, 31, 1, 3, 1, 2, 5, 9, 4, 9, 4, 7, 4,
+    10, 2, 5, 2, 3, 3, 6, 4, 10, 4, 7, 4, 8, 1, 2, 8,
+    4, 1, 5, 4, 10, 4, 8, 1, 3, 3, 53, 5, 50, 1, 2, 1,
+    8, 1, 36, 5, 108, 1, 2, 1, 10, 1, 3, 1, 146, 1, 1, 159,
+    1, 1, 18, 1, 213, 3, 1, 2, 1, 14, 1, 159, 1, 1, 148, 1,
+    1, 2, 1, 9, 1, 2, 1, 147, 1, 1, 2, 2, 4, 3, 1, 2,
+    149, 1, 3, 1, 4, 2, 2, 42,
+};
+const rle2 rle_onTheHourWords_midnight = {163, 44, RLE2_DELTA, 0, nullptr, runs_onTheHourWords_midnight};
+
+const TimeWord hourWords[] = {
+    {0, 0, nullptr},  // ""
+    {93, -31, &rle_hourWords_one},  // "one"
+    {95, -41, &rle_hourWords_two},  // "two"
+    {50, -45, &rle_hourWords_three},  // "three"
+    {81, -46, &rle_hourWords_four},  // "four"
+    {99, -46, &rle_hourWords_five},  // "five"
+    {127, -46, &rle_hourWords_six},  // "six"
+    {40, -31, &rle_hourWords_seven},  // "seven"
+    {58, -46, &rle_hourWords_eight},  // "eight"
+    {78, -46, &rle_hourWords_nine},  // "nine"
+    {111, -41, &rle_hourWords_ten},  // "ten"
+    {16, -45, &rle_hourWords_eleven},  // "eleven"
+    {15, -45, &rle_hourWords_twelve},  // "twelve"
+};
+
+const TimeWord minuteWords[] = {
+    {0, 0, nullptr},  // ""
+    {133, -20, &rle_minuteWords_one},  // "one"
+    {133, -25, &rle_minuteWords_two},  // "two"
+    {109, -31, &rle_minuteWords_three},  // "three"
+    {127, -32, &rle_minuteWords_four},  // "four"
+    {135, -32, &rle_minuteWords_five},  // "five"
+    {153, -29, &rle_minuteWords_six},  // "six"
+    {98, -20, &rle_minuteWords_seven},  // "seven"
+    {109, -31, &rle_minuteWords_eight},  // "eight"
+    {123, -29, &rle_minuteWords_nine},  // "nine"
+    {146, -25, &rle_minuteWords_ten},  // "ten"
+    {80, -31, &rle_minuteWords_eleven},  // "eleven"
+    {79, -31, &rle_minuteWords_twelve},  // "twelve"
+    {62, -31, &rle_minuteWords_thirteen},  // "thirteen"
+    {50, -32, &rle_minuteWords_fourteen},  // "fourteen"
+    {88, -32, &rle_minuteWords_fifteen},  // "fifteen"
+    {74, -29, &rle_minuteWords_sixteen},  // "sixteen"
+    {18, -25, &rle_minuteWords_seventeen},  // "seventeen"
+    {44, -31, &rle_minuteWords_eighteen},  // "eighteen"
+    {44, -29, &rle_minuteWords_nineteen},  // "nineteen"
+};
+
+const TimeWord decadeWords[] = {
+    {156, -31, &rle_decadeWords_oh},  // "oh"
+    {0, 0, nullptr},
+    {76, -25, &rle_decadeWords_twenty},  // "twenty"
+    {106, -31, &rle_decadeWords_thirty},  // "thirty"
+    {118, -32, &rle_decadeWords_forty},  // "forty"
+    {132, -32, &rle_decadeWords_fifty},  // "fifty"
+};
+
+const TimeWord onTheHourWords[] = {
+    {64, -31, &rle_onTheHourWords_o_clock},  // "o'clock"
+    {110, -20, &rle_onTheHourWords_noon},  // "noon"
+    {37, -31, &rle_onTheHourWords_midnight},  // "midnight"
+};
+
+const uint8_t hourYAdvance = 60;
+const uint8_t minuteYAdvance = 52;
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "rle.h"
+
+// a word TimeScreen draws, pre-rendered and right justified by
+// tools/timewords.py. Regenerate TimeWords.cpp if the fonts or words change,
+// the build fails if it doesn't match them.
+typedef struct {
+  const int16_t x;    // left edge of the word
+  const int8_t top;   // top of the word relative to the baseline
+  const rle2 *image;  // nullptr if there is nothing to draw
+} TimeWord;
+
+enum { OCLOCK, NOON, MIDNIGHT };
+
+extern const TimeWord hourWords[13];      // by hour, OptimaLTStd_Black32pt7b
+extern const TimeWord minuteWords[20];    // by minute, OptimaLTStd22pt7b
+extern const TimeWord decadeWords[6];     // by tens of minutes
+extern const TimeWord onTheHourWords[3];  // by OCLOCK, NOON or MIDNIGHT
+extern const uint8_t hourYAdvance;        // line heights of the fonts
+extern const uint8_t minuteYAdvance;
@@ -1,18 +1,37 @@
 #include "WrappedTextScreen.h"
 
-#include "GFXTextUtil.h"
 #include "OptimaLTStd7pt7b.h"
 #include "Watchy.h"
 
+RTC_DATA_ATTR TextLayout WrappedTextScreen::layout;
+RTC_DATA_ATTR uint8_t WrappedTextScreen::page;
+
+const int16_t margin = 20;
+const int16_t textWidth = DISPLAY_WIDTH - 2 * margin;
+const int16_t textHeight = DISPLAY_HEIGHT - 2 * margin;
+
 void WrappedTextScreen::show() {
   Watchy::RTC.setRefresh(RTC_REFRESH_NONE);
-  const int16_t margin = 20;
   const uint16_t fgColor = (bgColor == GxEPD_WHITE ? GxEPD_BLACK : GxEPD_WHITE);
   Watchy::display.fillScreen(bgColor);
-  Watchy::display.drawRect(margin - 2, margin - 2,
-                           DISPLAY_WIDTH - 2 * margin + 2,
-                           DISPLAY_HEIGHT - 2 * margin + 2, fgColor);
-  drawWordWrappedText(Watchy::display, margin, margin,
-                      DISPLAY_WIDTH - 2 * margin, DISPLAY_HEIGHT - 2 * margin,
-                      text, OptimaLTStd7pt7b);
+  Watchy::display.drawRect(margin - 2, margin - 2, textWidth + 2,
+                           textHeight + 2, fgColor);
+  if (layout.layout(text, OptimaLTStd7pt7b, textWidth)) {
+    page = 0;
+  }
+  layout.drawPage(Watchy::display, margin, margin, textHeight, page);
+}
+
+void WrappedTextScreen::up() {
+  if (page > 0) {
+    page--;
+    Watchy::markDirty();
+  }
+}
+
+void WrappedTextScreen::down() {
+  if (page + 1 < layout.pages(textHeight)) {
+    page++;
+    Watchy::markDirty();
+  }
 }
\ No newline at end of file
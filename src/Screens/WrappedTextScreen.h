@@ -1,20 +1,27 @@
 #pragma once
 
+#include "GFXTextUtil.h"
 #include "Screen.h"
 
 class WrappedTextScreen : public Screen {
  private:
   const char *text;
   const char *altText;
+  // kept in RTC memory so that paging through the text doesn't have to lay it
+  // out again on every wake
+  static TextLayout layout;
+  static uint8_t page;
 
  public:
   WrappedTextScreen(const char *t, const char *at, uint16_t bg = GxEPD_WHITE) : Screen(bg), text(t), altText(at){};
   virtual void show() override;
+  virtual void up() override;    // previous page
+  virtual void down() override;  // next page
   virtual void menu() {  // swap the text
     const char *t = text;
     text = altText;
     altText = t;
-    Watchy::showWatchFace(true, this);
+    Watchy::markDirty();
   };
   void setText(const char *t) { text = t; };
 };
\ No newline at end of file
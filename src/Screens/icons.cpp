@@ -2,129 +2,137 @@
 
 #include "rle.h"
 
-const uint8_t bitmap_battery[] = {
-    255, 0,  255, 0,  255, 0,  43,  16, 80,  16, 80, 16, 80, 16, 80, 16, 80, 16,
-    80,  16, 80,  16, 71,  34, 61,  36, 59,  38, 57, 40, 56, 40, 56, 40, 56, 40,
-    56,  40, 56,  40, 56,  40, 56,  40, 56,  40, 56, 40, 56, 40, 56, 40, 56, 40,
-    56,  40, 56,  40, 56,  40, 56,  40, 56,  40, 56, 40, 56, 40, 56, 40, 56, 40,
-    56,  40, 56,  40, 56,  40, 56,  40, 56,  40, 56, 40, 56, 40, 56, 40, 56, 40,
-    56,  40, 56,  40, 56,  40, 56,  40, 56,  40, 56, 40, 56, 40, 56, 40, 56, 40,
-    56,  40, 56,  40, 56,  40, 56,  40, 56,  40, 56, 40, 56, 40, 56, 40, 56, 40,
-    56,  40, 56,  40, 56,  40, 56,  40, 56,  40, 56, 40, 56, 40, 56, 40, 56, 40,
-    56,  40, 56,  40, 56,  40, 56,  40, 56,  40, 56, 40, 56, 40, 56, 40, 57, 38,
-    59,  36, 61,  34, 255, 0,  255, 0,  255, 0,  34};
-const rle rle_battery = {96, 96, bitmap_battery};
+// generated from the version 1 images in tools/icons_v1.cpp by tools/rle2.py
 
-const uint8_t bitmap_bluetooth[] = {
-    255, 0,  255, 0,  255, 0,   47, 4,   92, 5,   91, 6,  90, 7,  89, 8,  88,
-    9,   87, 10,  86, 11,  85,  12, 84,  13, 83,  14, 82, 15, 62, 1,  18, 16,
-    60,  3,  17,  17, 58,  5,   16, 18,  56, 7,   15, 19, 54, 9,  14, 8,  1,
-    11,  52, 11,  13, 8,   2,   11, 52,  11, 12,  8,  3,  11, 52, 11, 11, 8,
-    4,   11, 52,  11, 10,  8,   5,  11,  52, 11,  9,  8,  6,  11, 52, 11, 8,
-    8,   7,  11,  52, 11,  7,   8,  7,   11, 53,  11, 6,  8,  6,  11, 55, 11,
-    5,   8,  5,   11, 57,  11,  4,  8,   4,  11,  59, 11, 3,  8,  3,  11, 61,
-    11,  2,  8,   2,  11,  63,  11, 1,   8,  1,   11, 65, 30, 67, 28, 69, 26,
-    71,  24, 73,  22, 75,  20,  77, 18,  79, 16,  81, 14, 83, 12, 84, 12, 83,
-    14,  81, 16,  79, 18,  77,  20, 75,  22, 73,  24, 71, 26, 69, 28, 67, 30,
-    65,  11, 1,   8,  1,   11,  63, 11,  2,  8,   2,  11, 61, 11, 3,  8,  3,
-    11,  59, 11,  4,  8,   4,   11, 57,  11, 5,   8,  5,  11, 55, 11, 6,  8,
-    6,   11, 53,  11, 7,   8,   7,  11,  51, 11,  8,  8,  7,  11, 50, 11, 9,
-    8,   6,  11,  50, 11,  10,  8,  5,   11, 50,  11, 11, 8,  4,  11, 50, 11,
-    12,  8,  3,   11, 50,  11,  13, 8,   2,  11,  52, 9,  14, 8,  1,  11, 54,
-    7,   15, 19,  56, 5,   16,  18, 58,  3,  17,  17, 60, 1,  18, 16, 80, 15,
-    81,  14, 82,  13, 83,  12,  84, 11,  85, 10,  86, 9,  87, 8,  88, 7,  89,
-    6,   90, 5,   91, 4,   255, 0,  255, 0,  255, 0,  51};
-const rle rle_bluetooth = {96, 96, bitmap_bluetooth};
+// 96x96, 37 bytes, delta rows
+const uint8_t runs_battery[] = {
+    168, 6, 16, 231, 5, 9, 16, 9, 61, 1, 34, 1, 59, 1, 36, 1,
+    57, 1, 38, 1, 152, 49, 1, 38, 1, 57, 1, 36, 1, 59, 1, 34,
+    1, 61, 34, 191, 5,
+};
+const rle2 rle_battery = {96, 96, RLE2_DELTA, 0, nullptr, runs_battery};
+
+// 96x96, 291 bytes
+const uint8_t runs_bluetooth[] = {
+    172, 6, 4, 92, 5, 91, 6, 90, 7, 89, 8, 88, 9, 87, 10, 86,
+    11, 85, 12, 84, 13, 83, 14, 82, 15, 62, 1, 18, 16, 60, 3, 17,
+    17, 58, 5, 16, 18, 56, 7, 15, 19, 54, 9, 14, 8, 1, 11, 52,
+    11, 13, 8, 2, 11, 52, 11, 12, 8, 3, 11, 52, 11, 11, 8, 4,
+    11, 52, 11, 10, 8, 5, 11, 52, 11, 9, 8, 6, 11, 52, 11, 8,
+    8, 7, 11, 52, 11, 7, 8, 7, 11, 53, 11, 6, 8, 6, 11, 55,
+    11, 5, 8, 5, 11, 57, 11, 4, 8, 4, 11, 59, 11, 3, 8, 3,
+    11, 61, 11, 2, 8, 2, 11, 63, 11, 1, 8, 1, 11, 65, 30, 67,
+    28, 69, 26, 71, 24, 73, 22, 75, 20, 77, 18, 79, 16, 81, 14, 83,
+    12, 84, 12, 83, 14, 81, 16, 79, 18, 77, 20, 75, 22, 73, 24, 71,
+    26, 69, 28, 67, 30, 65, 11, 1, 8, 1, 11, 63, 11, 2, 8, 2,
+    11, 61, 11, 3, 8, 3, 11, 59, 11, 4, 8, 4, 11, 57, 11, 5,
+    8, 5, 11, 55, 11, 6, 8, 6, 11, 53, 11, 7, 8, 7, 11, 51,
+    11, 8, 8, 7, 11, 50, 11, 9, 8, 6, 11, 50, 11, 10, 8, 5,
+    11, 50, 11, 11, 8, 4, 11, 50, 11, 12, 8, 3, 11, 50, 11, 13,
+    8, 2, 11, 52, 9, 14, 8, 1, 11, 54, 7, 15, 19, 56, 5, 16,
+    18, 58, 3, 17, 17, 60, 1, 18, 16, 80, 15, 81, 14, 82, 13, 83,
+    12, 84, 11, 85, 10, 86, 9, 87, 8, 88, 7, 89, 6, 90, 5, 91,
+    4, 176, 6,
+};
+const rle2 rle_bluetooth = {96, 96, 0, 0, nullptr, runs_bluetooth};
 
-const uint8_t bitmap_orientation[] = {
-    255, 0,  173, 8,  88, 8,  88, 8,  88,  8,  88, 8,  88, 8,  88, 8,  88, 8,
-    86,  12, 80,  20, 73, 26, 68, 30, 64,  34, 60, 38, 56, 42, 53, 44, 51, 18,
-    10,  18, 49,  15, 18, 15, 47, 13, 24,  13, 45, 12, 28, 12, 43, 12, 30, 12,
-    41,  11, 34,  11, 39, 11, 36, 11, 37,  11, 38, 11, 36, 10, 40, 10, 35, 10,
-    42,  10, 34,  9,  44, 9,  33, 9,  46,  9,  32, 9,  19, 8,  19, 9,  31, 9,
-    17,  14, 17,  9,  30, 8,  16, 18, 16,  8,  29, 9,  15, 20, 15, 9,  28, 8,
-    15,  22, 15,  8,  28, 8,  14, 24, 14,  8,  27, 9,  13, 26, 13, 9,  26, 8,
-    13,  28, 13,  8,  26, 8,  13, 12, 4,   12, 13, 8,  26, 8,  12, 11, 8,  11,
-    12,  8,  25,  9,  12, 9,  12, 9,  12,  9,  24, 8,  13, 9,  12, 9,  13, 8,
-    16,  16, 12,  9,  14, 9,  12, 16, 8,   16, 12, 9,  14, 9,  12, 16, 8,  16,
-    12,  8,  16,  8,  12, 16, 8,  16, 12,  8,  16, 8,  12, 16, 8,  16, 12, 8,
-    16,  8,  12,  16, 8,  16, 12, 8,  16,  8,  12, 16, 8,  16, 12, 9,  14, 9,
-    12,  16, 8,   16, 12, 9,  14, 9,  12,  16, 16, 8,  13, 9,  12, 9,  13, 8,
-    24,  9,  12,  9,  12, 9,  12, 9,  25,  8,  12, 11, 8,  11, 12, 8,  26, 8,
-    13,  12, 4,   12, 13, 8,  26, 8,  13,  28, 13, 8,  26, 9,  13, 26, 13, 9,
-    27,  8,  14,  24, 14, 8,  28, 8,  15,  22, 15, 8,  28, 9,  15, 20, 15, 9,
-    29,  8,  16,  18, 16, 8,  30, 9,  17,  14, 17, 9,  31, 9,  19, 8,  19, 9,
-    32,  9,  46,  9,  33, 9,  44, 9,  34,  10, 42, 10, 35, 10, 40, 10, 36, 11,
-    38,  11, 37,  11, 36, 11, 39, 11, 34,  11, 41, 12, 30, 12, 43, 12, 28, 12,
-    45,  13, 24,  13, 47, 15, 18, 15, 49,  18, 10, 18, 51, 44, 53, 42, 56, 38,
-    60,  34, 64,  30, 68, 26, 73, 20, 80,  12, 86, 8,  88, 8,  88, 8,  88, 8,
-    88,  8,  88,  8,  88, 8,  88, 8,  255, 0,  173};
-const rle rle_orientation = {96, 96, bitmap_orientation};
+// 96x96, 387 bytes
+const uint8_t runs_orientation[] = {
+    172, 3, 8, 88, 8, 88, 8, 88, 8, 88, 8, 88, 8, 88, 8, 88,
+    8, 86, 12, 80, 20, 73, 26, 68, 30, 64, 34, 60, 38, 56, 42, 53,
+    44, 51, 18, 10, 18, 49, 15, 18, 15, 47, 13, 24, 13, 45, 12, 28,
+    12, 43, 12, 30, 12, 41, 11, 34, 11, 39, 11, 36, 11, 37, 11, 38,
+    11, 36, 10, 40, 10, 35, 10, 42, 10, 34, 9, 44, 9, 33, 9, 46,
+    9, 32, 9, 19, 8, 19, 9, 31, 9, 17, 14, 17, 9, 30, 8, 16,
+    18, 16, 8, 29, 9, 15, 20, 15, 9, 28, 8, 15, 22, 15, 8, 28,
+    8, 14, 24, 14, 8, 27, 9, 13, 26, 13, 9, 26, 8, 13, 28, 13,
+    8, 26, 8, 13, 12, 4, 12, 13, 8, 26, 8, 12, 11, 8, 11, 12,
+    8, 25, 9, 12, 9, 12, 9, 12, 9, 24, 8, 13, 9, 12, 9, 13,
+    8, 16, 16, 12, 9, 14, 9, 12, 16, 8, 16, 12, 9, 14, 9, 12,
+    16, 8, 16, 12, 8, 16, 8, 12, 16, 8, 16, 12, 8, 16, 8, 12,
+    16, 8, 16, 12, 8, 16, 8, 12, 16, 8, 16, 12, 8, 16, 8, 12,
+    16, 8, 16, 12, 9, 14, 9, 12, 16, 8, 16, 12, 9, 14, 9, 12,
+    16, 16, 8, 13, 9, 12, 9, 13, 8, 24, 9, 12, 9, 12, 9, 12,
+    9, 25, 8, 12, 11, 8, 11, 12, 8, 26, 8, 13, 12, 4, 12, 13,
+    8, 26, 8, 13, 28, 13, 8, 26, 9, 13, 26, 13, 9, 27, 8, 14,
+    24, 14, 8, 28, 8, 15, 22, 15, 8, 28, 9, 15, 20, 15, 9, 29,
+    8, 16, 18, 16, 8, 30, 9, 17, 14, 17, 9, 31, 9, 19, 8, 19,
+    9, 32, 9, 46, 9, 33, 9, 44, 9, 34, 10, 42, 10, 35, 10, 40,
+    10, 36, 11, 38, 11, 37, 11, 36, 11, 39, 11, 34, 11, 41, 12, 30,
+    12, 43, 12, 28, 12, 45, 13, 24, 13, 47, 15, 18, 15, 49, 18, 10,
+    18, 51, 44, 53, 42, 56, 38, 60, 34, 64, 30, 68, 26, 73, 20, 80,
+    12, 86, 8, 88, 8, 88, 8, 88, 8, 88, 8, 88, 8, 88, 8, 88,
+    8, 172, 3,
+};
+const rle2 rle_orientation = {96, 96, 0, 0, nullptr, runs_orientation};
 
-const uint8_t bitmap_settings[] = {
-    255, 0,  255, 0,  255, 0,  42, 18, 77, 20, 76, 20, 76, 20, 76,  20, 75,  22,
-    74,  22, 74,  22, 74,  8,  6,  8,  74, 8,  6,  8,  74, 8,  6,   8,  74,  8,
-    6,   8,  55,  3,  15,  9,  6,  9,  15, 3,  35, 6,  11, 10, 7,   11, 11,  6,
-    34,  9,  6,   12, 8,   12, 6,  9,  33, 12, 3,  13, 8,  13, 3,   12, 31,  29,
-    8,   29, 30,  29, 8,   29, 29, 29, 10, 29, 28, 26, 16, 26, 27,  25, 20,  25,
-    25,  24, 24,  24, 24,  9,  3,  11, 26, 11, 3,  9,  23, 10, 5,   7,  30,  7,
-    5,   10, 22,  9,  9,   3,  12, 8,  12, 3,  9,  9,  21, 10, 21,  14, 21,  10,
-    20,  9,  20,  18, 20,  9,  19, 11, 18, 20, 18, 11, 18, 13, 15,  22, 15,  13,
-    19,  13, 13,  24, 13,  13, 21, 13, 11, 26, 11, 13, 23, 14, 8,   28, 8,   14,
-    26,  13, 7,   11, 6,   11, 7,  13, 29, 12, 6,  10, 10, 10, 6,   12, 31,  11,
-    6,   9,  12,  9,  6,   11, 34, 9,  6,  8,  14, 8,  7,  8,  36,  8,  6,   9,
-    14,  9,  6,   8,  36,  8,  6,  8,  16, 8,  6,  8,  36, 8,  6,   8,  16,  8,
-    6,   8,  36,  8,  6,   8,  16, 8,  6,  8,  36, 8,  6,  8,  16,  8,  6,   8,
-    36,  8,  6,   8,  16,  8,  6,  8,  36, 8,  6,  8,  16, 8,  6,   8,  36,  8,
-    6,   9,  14,  9,  6,   8,  36, 8,  7,  8,  14, 8,  7,  8,  34,  11, 6,   9,
-    12,  9,  6,   11, 31,  12, 6,  10, 10, 10, 6,  12, 29, 13, 7,   11, 6,   11,
-    7,   13, 26,  14, 8,   28, 8,  14, 23, 13, 11, 26, 11, 13, 21,  13, 13,  24,
-    13,  13, 19,  13, 15,  22, 15, 13, 18, 12, 17, 20, 18, 11, 19,  9,  20,  18,
-    20,  9,  20,  9,  22,  14, 22, 9,  21, 9,  9,  3,  12, 8,  12,  3,  9,   9,
-    22,  10, 5,   7,  30,  7,  5,  10, 23, 9,  3,  11, 26, 11, 3,   9,  24,  24,
-    24,  24, 25,  25, 20,  25, 27, 26, 16, 26, 28, 29, 10, 29, 29,  29, 8,   29,
-    30,  29, 8,   29, 31,  12, 3,  13, 8,  13, 3,  12, 33, 9,  6,   12, 8,   12,
-    6,   9,  34,  6,  11,  11, 7,  10, 11, 6,  35, 3,  15, 9,  6,   9,  15,  3,
-    55,  8,  6,   8,  74,  8,  6,  8,  74, 8,  6,  8,  74, 8,  6,   8,  74,  22,
-    74,  22, 74,  22, 75,  20, 76, 20, 76, 20, 76, 20, 77, 18, 255, 0,  255, 0,
-    255, 0,  42};
-const rle rle_settings = {96, 96, bitmap_settings};
+// 96x96, 443 bytes
+const uint8_t runs_settings[] = {
+    167, 6, 18, 77, 20, 76, 20, 76, 20, 76, 20, 75, 22, 74, 22, 74,
+    22, 74, 8, 6, 8, 74, 8, 6, 8, 74, 8, 6, 8, 74, 8, 6,
+    8, 55, 3, 15, 9, 6, 9, 15, 3, 35, 6, 11, 10, 7, 11, 11,
+    6, 34, 9, 6, 12, 8, 12, 6, 9, 33, 12, 3, 13, 8, 13, 3,
+    12, 31, 29, 8, 29, 30, 29, 8, 29, 29, 29, 10, 29, 28, 26, 16,
+    26, 27, 25, 20, 25, 25, 24, 24, 24, 24, 9, 3, 11, 26, 11, 3,
+    9, 23, 10, 5, 7, 30, 7, 5, 10, 22, 9, 9, 3, 12, 8, 12,
+    3, 9, 9, 21, 10, 21, 14, 21, 10, 20, 9, 20, 18, 20, 9, 19,
+    11, 18, 20, 18, 11, 18, 13, 15, 22, 15, 13, 19, 13, 13, 24, 13,
+    13, 21, 13, 11, 26, 11, 13, 23, 14, 8, 28, 8, 14, 26, 13, 7,
+    11, 6, 11, 7, 13, 29, 12, 6, 10, 10, 10, 6, 12, 31, 11, 6,
+    9, 12, 9, 6, 11, 34, 9, 6, 8, 14, 8, 7, 8, 36, 8, 6,
+    9, 14, 9, 6, 8, 36, 8, 6, 8, 16, 8, 6, 8, 36, 8, 6,
+    8, 16, 8, 6, 8, 36, 8, 6, 8, 16, 8, 6, 8, 36, 8, 6,
+    8, 16, 8, 6, 8, 36, 8, 6, 8, 16, 8, 6, 8, 36, 8, 6,
+    8, 16, 8, 6, 8, 36, 8, 6, 9, 14, 9, 6, 8, 36, 8, 7,
+    8, 14, 8, 7, 8, 34, 11, 6, 9, 12, 9, 6, 11, 31, 12, 6,
+    10, 10, 10, 6, 12, 29, 13, 7, 11, 6, 11, 7, 13, 26, 14, 8,
+    28, 8, 14, 23, 13, 11, 26, 11, 13, 21, 13, 13, 24, 13, 13, 19,
+    13, 15, 22, 15, 13, 18, 12, 17, 20, 18, 11, 19, 9, 20, 18, 20,
+    9, 20, 9, 22, 14, 22, 9, 21, 9, 9, 3, 12, 8, 12, 3, 9,
+    9, 22, 10, 5, 7, 30, 7, 5, 10, 23, 9, 3, 11, 26, 11, 3,
+    9, 24, 24, 24, 24, 25, 25, 20, 25, 27, 26, 16, 26, 28, 29, 10,
+    29, 29, 29, 8, 29, 30, 29, 8, 29, 31, 12, 3, 13, 8, 13, 3,
+    12, 33, 9, 6, 12, 8, 12, 6, 9, 34, 6, 11, 11, 7, 10, 11,
+    6, 35, 3, 15, 9, 6, 9, 15, 3, 55, 8, 6, 8, 74, 8, 6,
+    8, 74, 8, 6, 8, 74, 8, 6, 8, 74, 22, 74, 22, 74, 22, 75,
+    20, 76, 20, 76, 20, 76, 20, 77, 18, 167, 6,
+};
+const rle2 rle_settings = {96, 96, 0, 0, nullptr, runs_settings};
 
-const uint8_t bitmap_steps[] = {
-    255, 0,  255, 0,  117, 5,  89, 9,  86, 12, 83, 13, 83, 14, 81,  15, 81,
-    16,  80, 16,  80, 16,  80, 16, 80, 16, 81, 14, 82, 14, 83, 12,  85, 10,
-    88,  6,  255, 0,  21,  5,  88, 10, 84, 13, 81, 16, 77, 20, 74,  23, 70,
-    26,  68, 29,  65, 32,  62, 34, 62, 35, 61, 35, 61, 13, 2,  21,  60, 10,
-    5,   22, 59,  8,  7,   23, 58, 8,  6,  25, 57, 8,  6,  26, 56,  8,  6,
-    28,  54, 8,   6,  30,  52, 8,  6,  16, 1,  16, 49, 8,  5,  16,  3,  20,
-    44,  8,  5,   16, 5,   18, 44, 8,  5,  16, 6,  17, 44, 8,  5,   16, 7,
-    16,  44, 8,   5,  16,  9,  14, 44, 8,  4,  16, 12, 12, 44, 8,   4,  16,
-    15,  9,  44,  8,  4,   16, 18, 6,  56, 16, 80, 16, 79, 17, 79,  18, 78,
-    19,  77, 20,  76, 21,  74, 23, 73, 24, 72, 9,  2,  14, 71, 9,   3,  14,
-    70,  9,  4,   13, 69,  10, 5,  12, 69, 9,  7,  11, 69, 9,  8,   10, 69,
-    9,   9,  9,   69, 9,   10, 8,  68, 9,  11, 8,  68, 9,  11, 8,   68, 9,
-    11,  8,  68,  9,  11,  8,  68, 9,  11, 8,  67, 9,  12, 8,  67,  9,  12,
-    8,   67, 9,   12, 8,   67, 9,  12, 8,  67, 8,  13, 8,  66, 9,   13, 8,
-    66,  9,  13,  8,  66,  9,  13, 8,  66, 8,  14, 8,  66, 8,  14,  8,  65,
-    9,   14, 8,   65, 9,   14, 8,  65, 9,  14, 8,  65, 8,  15, 8,   65, 8,
-    15,  8,  64,  9,  15,  8,  64, 9,  15, 8,  64, 8,  16, 8,  255, 0,  165};
-const rle rle_steps = {96, 96, bitmap_steps};
+// 96x96, 210 bytes, delta rows
+const uint8_t runs_steps[] = {
+    243, 4, 5, 89, 2, 5, 2, 86, 1, 9, 2, 83, 1, 108, 1, 81,
+    1, 110, 1, 208, 3, 1, 14, 1, 177, 1, 1, 12, 1, 83, 1, 10,
+    1, 85, 2, 6, 2, 88, 6, 180, 1, 5, 88, 3, 5, 2, 84, 2,
+    10, 1, 81, 2, 13, 1, 77, 3, 16, 1, 74, 2, 20, 1, 70, 3,
+    91, 2, 26, 1, 65, 2, 29, 1, 62, 2, 128, 1, 1, 170, 1, 2,
+    20, 1, 70, 3, 23, 1, 67, 2, 27, 1, 72, 1, 23, 1, 96, 1,
+    96, 2, 96, 2, 82, 1, 13, 3, 62, 1, 15, 1, 1, 1, 15, 5,
+    76, 2, 96, 1, 96, 1, 96, 2, 70, 1, 15, 1, 9, 2, 96, 3,
+    96, 3, 50, 8, 38, 6, 151, 1, 1, 112, 1, 96, 1, 96, 1, 96,
+    1, 74, 1, 21, 1, 96, 1, 81, 2, 13, 1, 82, 1, 13, 1, 82,
+    1, 82, 1, 13, 1, 90, 1, 5, 1, 96, 1, 96, 1, 96, 1, 76,
+    1, 8, 1, 213, 3, 1, 8, 1, 254, 2, 1, 86, 1, 167, 2, 1,
+    182, 1, 1, 167, 2, 1, 182, 1, 1, 199, 1, 1, 87, 8, 16, 8,
+    196, 2,
+};
+const rle2 rle_steps = {96, 96, RLE2_DELTA, 0, nullptr, runs_steps};
 
-const uint8_t bitmap_wifi[] = {
-    255, 0,  255, 0,  255, 0,  255, 0,  255, 0,  255, 0,  237, 18, 73,  28,
-    64,  36, 57,  42, 51,  48, 46,  52, 42,  56, 38,  60, 34,  64, 31,  66,
-    28,  70, 25,  30, 12,  30, 22,  26, 24,  26, 19,  24, 30,  24, 17,  22,
-    36,  22, 15,  20, 42,  20, 13,  19, 46,  19, 11,  18, 50,  18, 10,  17,
-    52,  17, 11,  14, 56,  14, 13,  12, 58,  12, 15,  9,  62,  9,  17,  7,
-    31,  2,  31,  7,  19,  5,  24,  18, 24,  5,  21,  3,  21,  26, 21,  3,
-    23,  1,  20,  30, 20,  1,  43,  34, 60,  38, 56,  42, 52,  46, 49,  48,
-    47,  50, 45,  52, 43,  54, 42,  21, 12,  21, 43,  16, 20,  16, 45,  13,
-    24,  13, 47,  10, 28,  10, 49,  7,  32,  7,  51,  5,  34,  5,  53,  3,
-    36,  3,  55,  1,  38,  1,  255, 0,  105, 8,  85,  14, 80,  18, 77,  20,
-    75,  22, 74,  22, 75,  20, 77,  18, 79,  16, 81,  14, 83,  12, 85,  10,
-    87,  8,  89,  6,  91,  4,  93,  2,  255, 0,  255, 0,  255, 0,  255, 0,
-    255, 0,  255, 0,  149};
-const rle rle_wifi = {96, 96, bitmap_wifi};
+// 96x96, 174 bytes
+const uint8_t runs_wifi[] = {
+    231, 13, 18, 73, 28, 64, 36, 57, 42, 51, 48, 46, 52, 42, 56, 38,
+    60, 34, 64, 31, 66, 28, 70, 25, 30, 12, 30, 22, 26, 24, 26, 19,
+    24, 30, 24, 17, 22, 36, 22, 15, 20, 42, 20, 13, 19, 46, 19, 11,
+    18, 50, 18, 10, 17, 52, 17, 11, 14, 56, 14, 13, 12, 58, 12, 15,
+    9, 62, 9, 17, 7, 31, 2, 31, 7, 19, 5, 24, 18, 24, 5, 21,
+    3, 21, 26, 21, 3, 23, 1, 20, 30, 20, 1, 43, 34, 60, 38, 56,
+    42, 52, 46, 49, 48, 47, 50, 45, 52, 43, 54, 42, 21, 12, 21, 43,
+    16, 20, 16, 45, 13, 24, 13, 47, 10, 28, 10, 49, 7, 32, 7, 51,
+    5, 34, 5, 53, 3, 36, 3, 55, 1, 38, 1, 232, 2, 8, 85, 14,
+    80, 18, 77, 20, 75, 22, 74, 22, 75, 20, 77, 18, 79, 16, 81, 14,
+    83, 12, 85, 10, 87, 8, 89, 6, 91, 4, 93, 2, 143, 13,
+};
+const rle2 rle_wifi = {96, 96, 0, 0, nullptr, runs_wifi};
 
 // 'cloud', 96x96px
 // this is why we compress bitmaps, it's here just to demo ImageScreen
@@ -204,18 +212,11 @@ const uint8_t cloud [] = {
 	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 
-// 195 bytes
-const uint8_t bitmap_text[] = {
-    255, 0,   255, 0,   255, 0,   104, 62,  8,  66, 5,  68, 3,  70, 2,  70, 1,
-    224, 56,  16,  56,  16,  56,  16,  56,  16, 56, 16, 56, 16, 56, 16, 56, 16,
-    8,   40,  8,   16,  8,   40,  8,   16,  8,  40, 8,  16, 8,  40, 8,  16, 8,
-    40,  8,   16,  8,   40,  8,   16,  8,   40, 8,  16, 8,  40, 8,  16, 56, 16,
-    56,  16,  56,  16,  56,  16,  56,  16,  56, 16, 56, 16, 56, 16, 8,  40, 8,
-    16,  8,   40,  8,   16,  8,   40,  8,   16, 8,  40, 8,  16, 8,  40, 8,  16,
-    8,   40,  8,   16,  8,   40,  8,   16,  8,  40, 8,  16, 56, 16, 56, 16, 56,
-    16,  56,  16,  56,  16,  56,  16,  56,  16, 56, 16, 8,  28, 20, 16, 8,  28,
-    20,  16,  8,   28,  20,  16,  8,   28,  20, 16, 8,  28, 20, 16, 8,  28, 20,
-    16,  8,   28,  20,  16,  8,   28,  20,  16, 56, 16, 56, 16, 56, 16, 56, 16,
-    56,  16,  56,  16,  56,  16,  56,  224, 1,  70, 2,  70, 3,  68, 5,  66, 8,
-    62,  255, 0,   255, 0,   255, 0,   104};
-const rle rle_text = {72, 96, bitmap_text};
\ No newline at end of file
+// 72x96, 64 bytes, delta rows
+const uint8_t runs_text[] = {
+    229, 6, 62, 8, 2, 62, 2, 5, 1, 66, 1, 3, 1, 68, 1, 73,
+    1, 70, 1, 152, 1, 56, 144, 4, 40, 152, 4, 40, 152, 4, 40, 152,
+    4, 40, 152, 4, 28, 164, 4, 28, 156, 4, 56, 152, 1, 1, 70, 1,
+    73, 1, 68, 1, 3, 1, 66, 1, 5, 2, 62, 2, 8, 62, 157, 6,
+};
+const rle2 rle_text = {72, 96, RLE2_DELTA, 0, nullptr, runs_text};
\ No newline at end of file
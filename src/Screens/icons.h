@@ -1,11 +1,11 @@
 #pragma once
 
 #include "rle.h"
-extern const rle rle_battery;
-extern const rle rle_bluetooth;
-extern const rle rle_orientation;
-extern const rle rle_settings;
-extern const rle rle_steps;
-extern const rle rle_wifi;
+extern const rle2 rle_battery;
+extern const rle2 rle_bluetooth;
+extern const rle2 rle_orientation;
+extern const rle2 rle_settings;
+extern const rle2 rle_steps;
+extern const rle2 rle_wifi;
 extern const uint8_t cloud[];
-extern const rle rle_text;
\ No newline at end of file
+extern const rle2 rle_text;
\ No newline at end of file
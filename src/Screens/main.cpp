@@ -2,29 +2,20 @@
 #include "BuzzScreen.h"
 #include "CarouselScreen.h"
 #include "Events.h"
+#include "Faces.h"
 #include "GetLocation.h"
 #include "GetWeatherScreen.h"
-#include "IconScreen.h"
-#include "ImageScreen.h"
-#include "MenuScreen.h"
-#include "OptimaLTStd22pt7b.h"
 #include "OTAScreen.h"
 #include "SetLocationScreen.h"
 #include "SetTimeScreen.h"
-#include "ShowBatteryScreen.h"
 #include "ShowBluetoothScreen.h"
-#include "ShowOrientationScreen.h"
-#include "ShowStepsScreen.h"
 #include "ShowWifiScreen.h"
 #include "SyncTime.h"
 #include "SyncTimeScreen.h"
-#include "TimeScreen.h"
 #include "UpdateFWScreen.h"
 #include "Watchy.h"
 #include "WatchyErrors.h"
 #include "WeatherScreen.h"
-#include "WrappedTextScreen.h"
-#include "icons.h"
 
 #include <time.h>
 
@@ -37,7 +28,21 @@ GetWeatherScreen getWeatherScreen;
 BuzzScreen buzzScreen;
 OTAScreen otaScreen;
 
+const char *timezoneName(uint16_t i) {
+  return Watchy_GetLocation::posixLabel(i);
+}
+Screen *selectTimezone(uint16_t i) {
+  Watchy_GetLocation::currentLocation.timezone = Watchy_GetLocation::posix[i];
+  Watchy_GetLocation::timezoneSelected = true;
+  setenv("TZ", Watchy_GetLocation::currentLocation.timezone, 1);
+  tzset();
+  return Watchy::screen->parent;
+}
+MenuScreen timezoneMenu(timezoneName, selectTimezone,
+                        Watchy_GetLocation::numPosix);
+
 MenuItem menuItems[] = {{"Set Time", &setTimeScreen},
+                        {"Time Zone", &timezoneMenu},
                         {"Blufi", &blufiScreen},
                         {"Update (OTA)", &otaScreen},
                         {"Update (BLE)", &updateFWScreen},
@@ -48,30 +53,9 @@ MenuItem menuItems[] = {{"Set Time", &setTimeScreen},
 
 MenuScreen menu(menuItems, sizeof(menuItems) / sizeof(menuItems[0]));
 
-TimeScreen timeScreen;
 WeatherScreen weatherScreen;
-IconScreen battery(&rle_battery, "battery", OptimaLTStd22pt7b);
-IconScreen steps(&rle_steps, "steps", OptimaLTStd22pt7b);
-IconScreen orientation(&rle_orientation, "orientation", OptimaLTStd22pt7b);
-IconScreen bluetooth(&rle_bluetooth, "bluetooth", OptimaLTStd22pt7b);
-IconScreen wifi(&rle_wifi, "wifi", OptimaLTStd22pt7b);
-IconScreen settings(&rle_settings, "settings", OptimaLTStd22pt7b);
-IconScreen text(&rle_text, "wrap text", OptimaLTStd22pt7b);
-ImageScreen weather(cloud, 96, 96, "weather", OptimaLTStd22pt7b);
-ShowBatteryScreen showBattery;
 ShowBluetoothScreen showBluetooth;
-ShowOrientationScreen showOrientation;
-ShowStepsScreen showSteps;
 ShowWifiScreen showWifi;
-WrappedTextScreen wrappedTextScreen(
-    "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod "
-    "tempor incididunt ut labore et dolore magna aliqua. Ut enim ad minim "
-    "veniam, quis nostrud exercitation ullamco laboris nisi ut aliquip ex ea "
-    "commodo consequat. Duis aute irure dolor in reprehenderit in voluptate "
-    "velit esse cillum dolore eu fugiat nulla pariatur.",
-    "n0-=-5p4c35,.,withaverylongwordthatshouldbehardwrapped?\n\nnotice how "
-    "it goes away on screen refresh?        \t    \t         \r                "
-    "      \n     that's deep sleep.");
 
 CarouselItem carouselItems[] = {{&timeScreen, nullptr},
                                 {&weather, &weatherScreen},
@@ -100,6 +84,11 @@ void setup() {
   esp_log_level_set("*", static_cast<esp_log_level_t>(CORE_DEBUG_LEVEL));
 #endif
   log_d("micros %ld", micros());  // fail if debugging macros not defined
+#ifdef WATCHY_BENCH
+  if (esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_UNDEFINED) {
+    Watchy_Bench::run(benchItems, numBenchItems);
+  }
+#endif
 
   // initializing time and location can be a little tricky, because the
   // calls can fail for a number of reasons, but you don't want to just
@@ -127,5 +116,6 @@ void loop() {
   if (count % 10000 == 0) {
     log_i("%d", count/10000);
   }
+  Watchy_Event::Event::wait(portMAX_DELAY);
   Watchy_Event::Event::handleAll();
 }
\ No newline at end of file
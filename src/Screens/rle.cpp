@@ -2,29 +2,128 @@
 
 #include "Adafruit_GFX.h"
 #include "GxEPD2.h"
+#include "config.h"
 
 // this implements a simple RLE encoding. It expects an Adafruit GFX drawable,
-// the position to draw the image at, a pointer to a rle struct, and the color
-// of the image.
+// the position to draw the image at, a pointer to a rle2 struct, and the
+// color of the image.
 
-// does no sanity checking, length of bitmap, size of gfx
-void drawRLEBitmap(Adafruit_GFX &gfx, int16_t x, int16_t y, const rle *r,
+// each run of non-transparent bits is drawn as horizontal line(s), split at
+// the end of each row of the image, rather than pixel by pixel. On the Watchy
+// display that fills whole bytes of the frame buffer at a time.
+
+// read one variable length run count, and advance past it
+static uint32_t readRun(const uint8_t *&p) {
+  uint32_t n = 0;
+  uint8_t shift = 0;
+  uint8_t b;
+  do {
+    b = *p++;
+    n |= uint32_t(b & 0x7F) << shift;
+    shift += 7;
+  } while (b & 0x80);
+  return n;
+}
+
+// flip w bits of a row starting at bit x
+static void xorBits(uint8_t *bits, uint16_t x, uint16_t w) {
+  uint8_t *p = &bits[x / 8];
+  const uint8_t lead = x % 8;
+  if (lead != 0) {
+    uint8_t mask = 0xFF >> lead;
+    if (lead + w < 8) {
+      mask &= ~(0xFF >> (lead + w));
+      *p ^= mask;
+      return;
+    }
+    *p++ ^= mask;
+    w -= 8 - lead;
+  }
+  for (; w >= 8; w -= 8) {
+    *p++ ^= 0xFF;
+  }
+  if (w > 0) {
+    *p ^= ~(0xFF >> w);
+  }
+}
+
+// draw the set bits of a row as horizontal spans
+static void drawBits(Adafruit_GFX &gfx, int16_t x, int16_t y,
+                     const uint8_t *bits, uint16_t w, uint16_t color) {
+  uint16_t start = 0;
+  bool inSpan = false;
+  for (uint16_t i = 0; i < w; i++) {
+    if ((i % 8 == 0) && !inSpan && bits[i / 8] == 0) {
+      i += 7;  // skip empty bytes
+      continue;
+    }
+    const bool set = bits[i / 8] & (0x80 >> (i % 8));
+    if (set && !inSpan) {
+      start = i;
+      inSpan = true;
+    } else if (!set && inSpan) {
+      gfx.writeFastHLine(x + start, y, i - start, color);
+      inSpan = false;
+    }
+  }
+  if (inSpan) {
+    gfx.writeFastHLine(x + start, y, w - start, color);
+  }
+}
+
+// only decodes the rows that are on screen, or above them back to the nearest
+// index entry if there is an index.
+void drawRLEBitmap(Adafruit_GFX &gfx, int16_t x, int16_t y, const rle2 *r,
                    uint16_t color) {
+  const bool delta = r->flags & RLE2_DELTA;
+  if (delta && r->w > DISPLAY_WIDTH) {
+    log_e("delta image %u wide, wider than the display", r->w);
+    return;
+  }
+  // rows of the image that are on screen
+  const int32_t top = max(int32_t(0), -int32_t(y));
+  const int32_t bottom = min(int32_t(r->h), int32_t(gfx.height()) - y);
+  if (top >= bottom) {
+    return;
+  }
+  const uint8_t *run = r->runs;
   bool transparent = true;
-  const uint8_t *run = &(r->bitmap[0]);
-  uint8_t runCount = *run;
-  run++;
-  for (uint8_t y0 = 0; y0 < r->h; y0++) {
-    for (uint8_t x0 = 0; x0 < r->w; x0++) {
-      while (runCount == 0) {
-        runCount = *run;
-        run++;
-        transparent = !transparent;
-      }
+  int32_t y0 = 0;
+  if (r->index != nullptr) {
+    const uint16_t entry = r->index[top / r->indexStep];
+    run += entry & RLE2_INDEX_OFFSET;
+    transparent = !(entry & RLE2_INDEX_OPAQUE);
+    y0 = top / r->indexStep * r->indexStep;
+  }
+  uint8_t bits[(DISPLAY_WIDTH + 7) / 8];  // current row, if delta
+  memset(bits, 0, sizeof(bits));
+  uint16_t x0 = 0;
+  gfx.startWrite();
+  while (y0 < bottom) {
+    uint32_t runCount = readRun(run);
+    while (runCount > 0 && y0 < bottom) {
+      const uint16_t span = min(runCount, uint32_t(r->w - x0));
       if (!transparent) {
-        gfx.drawPixel(x + x0, y + y0, color);
+        if (delta) {
+          xorBits(bits, x0, span);
+        } else if (y0 >= top) {
+          gfx.writeFastHLine(x + x0, y + y0, span, color);
+        }
+      }
+      runCount -= span;
+      x0 += span;
+      if (x0 == r->w) {
+        if (delta && y0 >= top) {
+          drawBits(gfx, x, y + y0, bits, r->w, color);
+        }
+        x0 = 0;
+        y0++;
+        if (delta && r->index != nullptr && y0 % r->indexStep == 0) {
+          memset(bits, 0, sizeof(bits));
+        }
       }
-      runCount--;
     }
+    transparent = !transparent;
   }
-}
\ No newline at end of file
+  gfx.endWrite();
+}
@@ -2,11 +2,12 @@
 
 #include "Adafruit_GFX.h"
 
-// represents a simple rle encoded image. w and h are the width and height of
-// the image (max 255 x 255) and bitmap represents runs of bits. The first
-// uint8_t is a count of transparent bits, then a count of non-transparent
-// bits, then transparent, and so on. The bits are recorded as one long stream
-// of bits concatenated together in row order.
+// version 1 of the format, which the icons were first drawn in (they're kept
+// that way in tools/icons_v1.cpp), represents a simple rle encoded image. w
+// and h are the width and height of the image (max 255 x 255) and bitmap
+// represents runs of bits. The first uint8_t is a count of transparent bits,
+// then a count of non-transparent bits, then transparent, and so on. The bits
+// are recorded as one long stream of bits concatenated together in row order.
 
 // a 10 x 10 image of a square:
 //
@@ -34,10 +35,41 @@
 
 // there's a PNG to RLE converter in go at https://github.com/charles-haynes/png2rle
 
+// version 2 of the format. Images can be up to 65535 x 65535 and the runs are
+// still transparent, non-transparent, transparent... but each run is stored as
+// a variable length count: 7 bits per byte, least significant 7 bits first,
+// with the top bit set on every byte except the last. So runs up to 127 take
+// one byte, and there is no more padding long runs with 255, 0, 255...
+//
+// the 10 x 10 square above would be { 10, 10, 0, 0, nullptr, &{22,6,4,...,22} }
+//
+// If RLE2_DELTA is set in flags, each row is stored XOR'ed with the row above
+// it (the first row with an empty row). Images with many identical or
+// similar rows (battery, steps) compress much better that way. Images with
+// lots of diagonals compress better without. A delta image can't be wider
+// than the display, drawing decodes its rows into a buffer that size.
+//
+// If index is not nullptr there is an entry for every indexStep rows, so
+// drawing can start at the first row that is on screen rather than decoding
+// from the top. Runs never cross an indexed row, and in a delta image the
+// indexed rows are stored XOR'ed with an empty row. Each entry is the byte
+// offset into runs of the first run of that row, with RLE2_INDEX_OPAQUE set
+// if that first run is non-transparent.
+//
+// It's the only one drawRLEBitmap draws. tools/rle2.py converts version 1
+// images and PBM files to it.
+
+const uint8_t RLE2_DELTA = 0x01;
+const uint16_t RLE2_INDEX_OPAQUE = 0x8000;
+const uint16_t RLE2_INDEX_OFFSET = 0x7FFF;
+
 typedef struct {
-  const uint8_t w, h;
-  const uint8_t *bitmap;
-} rle;
+  const uint16_t w, h;
+  const uint8_t flags;
+  const uint8_t indexStep;  // rows between index entries
+  const uint16_t *index;    // (h + indexStep - 1) / indexStep entries
+  const uint8_t *runs;
+} rle2;
 
-void drawRLEBitmap(Adafruit_GFX &gfx, int16_t x, int16_t y, const rle *r,
+void drawRLEBitmap(Adafruit_GFX &gfx, int16_t x, int16_t y, const rle2 *r,
                    uint16_t color);
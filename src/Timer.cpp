@@ -0,0 +1,46 @@
+#include "Timer.h"
+
+namespace Watchy_Timer {
+
+Timer *Timer::_timers[MAX_TIMERS];
+uint8_t Timer::_numTimers = 0;
+RTC_DATA_ATTR time_t Timer::_due[MAX_TIMERS];
+
+Timer::Timer(const char *name, Callback fire)
+    : _name(name), _fire(fire), _slot(_numTimers) {
+  assert(_numTimers < MAX_TIMERS);
+  _timers[_numTimers++] = this;
+}
+
+void Timer::at(time_t t) {
+  log_d("%s at %ld", _name, t);
+  _due[_slot] = t;
+}
+
+time_t Timer::due() const { return _due[_slot]; }
+
+bool Timer::pending() const { return due() > now(); }
+
+time_t Timer::next() {
+  time_t t = 0;
+  for (uint8_t i = 0; i < _numTimers; i++) {
+    if ((_timers[i]->_fire != nullptr) && (_due[i] != 0) &&
+        ((t == 0) || (_due[i] < t))) {
+      t = _due[i];
+    }
+  }
+  return t;
+}
+
+void Timer::runDue() {
+  const time_t t = now();
+  for (uint8_t i = 0; i < _numTimers; i++) {
+    if ((_timers[i]->_fire != nullptr) && (_due[i] != 0) && (_due[i] <= t)) {
+      log_i("%s due at %ld, now %ld", _timers[i]->_name, _due[i], t);
+      _due[i] = 0;  // before the callback, which may set it again
+      _timers[i]->_fire();
+    }
+  }
+}
+
+}  // namespace Watchy_Timer
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <time.h>
+
+#include <Arduino.h>
+#include <TimeLib.h>
+
+namespace Watchy_Timer {
+
+// a deadline kept in RTC memory, so that it survives deep sleep. A timer with
+// a callback wakes the watch when it's due, and the callback is run on the
+// first wake at or after that time. It isn't rearmed, a periodic callback
+// sets the next deadline itself. A timer without a callback is just a
+// remembered deadline, for throttling something.
+//
+// All the timers share one wake. A screen that refreshes every minute (or
+// second) runs the due ones on its ticks. Otherwise the ESP timer is set to
+// wake for the earliest one.
+class Timer {
+ public:
+  static const uint8_t MAX_TIMERS = 8;
+  typedef void (*Callback)();
+
+  // deadlines are found again after deep sleep by the order the timers were
+  // constructed in, so timers must be globals
+  Timer(const char *name, Callback fire = nullptr);
+  const char *Name() const { return _name; }
+  void at(time_t t);  // due at t, 0 to cancel
+  void in(time_t seconds) { at(now() + seconds); }
+  void cancel() { at(0); }
+  time_t due() const;  // 0 if it isn't set
+  // set, and not due yet. Throttles check this.
+  bool pending() const;
+
+  // the earliest deadline of the timers with a callback, 0 if none are set
+  static time_t next();
+  // runs the callbacks of the timers that are due, once each
+  static void runDue();
+
+ private:
+  const char *_name;
+  const Callback _fire;
+  uint8_t _slot;
+  static Timer *_timers[MAX_TIMERS];
+  static uint8_t _numTimers;
+  static time_t _due[MAX_TIMERS];
+};
+
+}  // namespace Watchy_Timer
@@ -6,8 +6,12 @@
 #include "GetLocation.h"  // bad dependency
 #include "Screen.h"
 #include "Sensor.h"
+#include "Timer.h"
 #include "WatchyErrors.h"
 #include "esp_wifi.h"
+#include "interrupt_handler.h"
+#include <driver/gpio.h>
+#include <soc/gpio_struct.h>
 
 namespace Watchy {
 
@@ -17,11 +21,19 @@ uint16_t _readRegister(uint8_t address, uint8_t reg, uint8_t *data,
                        uint16_t len);
 uint16_t _writeRegister(uint8_t address, uint8_t reg, uint8_t *data,
                         uint16_t len);
+void prepareNextFrame();
+bool fullRefreshDue(bool transition);
+TickType_t ticksToNextRefresh();
 
 WatchyRTC RTC;
-GxEPD2_BW<GxEPD2_154_D67, GxEPD2_154_D67::HEIGHT> display(
-  GxEPD2_154_D67(CS, DC, RESET, BUSY));
+WatchyDisplay display(GxEPD2_154_D67(CS, DC, RESET, BUSY));
 RTC_DATA_ATTR Screen *screen = nullptr;
+// set by markDirty, possibly from a background task
+volatile bool dirty = false;
+volatile bool screenChanged = false;  // by setScreen, since the last draw
+// the screen whose frame is in the frame buffer. The frame buffer doesn't
+// survive deep sleep, so after a wake it's nobody's.
+const Screen *drawn = nullptr;
 
 RTC_DATA_ATTR BMA423 sensor;
 RTC_DATA_ATTR bool WIFI_CONFIGURED;
@@ -63,10 +75,15 @@ QueueHandle_t i2cMutex = xSemaphoreCreateRecursiveMutex();
 
 tmElements_t currentTime;  // should probably be in SyncTime
 
-// doesn't persist over deep sleep. don't care.
-std::vector<OnWakeCallback> owcVec;
+// doesn't persist over deep sleep. don't care. Screens add to it from their
+// constructors, which can run before the globals of this file are
+// constructed, so it's constructed on first use.
+std::vector<OnWakeCallback> &owcVec() {
+  static std::vector<OnWakeCallback> owcs;
+  return owcs;
+}
 
-void AddOnWakeCallback(const OnWakeCallback owc) { owcVec.push_back(owc); }
+void AddOnWakeCallback(const OnWakeCallback owc) { owcVec().push_back(owc); }
 
 const char *wakeupReasonToString(esp_sleep_wakeup_cause_t wakeup_reason) {
   switch (wakeup_reason) {
@@ -95,6 +112,62 @@ const char *wakeupReasonToString(esp_sleep_wakeup_cause_t wakeup_reason) {
 
 uint64_t start;
 
+// how long wakes take, by what woke us up, kept across deep sleep, and how
+// many of them had to wake the panel up. The ones that didn't, because
+// nothing on it changed, saved the panel init.
+typedef enum { WAKE_TIMER, WAKE_BUTTON, WAKE_OTHER, WAKE_TYPES } WakeType;
+const char *wakeTypeNames[WAKE_TYPES] = {"timer", "button", "other"};
+typedef struct {
+  uint32_t wakes;
+  uint64_t wakeMicros;
+  uint32_t panelInits;
+  uint64_t panelInitMicros;
+} WakeStats;
+RTC_DATA_ATTR WakeStats wakeStats[WAKE_TYPES];
+WakeType wakeType = WAKE_OTHER;
+// wakes by the screen that was showing when we woke up, to see how often each
+// screen's refresh wakes the watch
+typedef struct {
+  const Screen *screen;  // nullptr if the entry is free
+  uint32_t wakes[WAKE_TYPES];
+} ScreenWakes;
+RTC_DATA_ATTR ScreenWakes screenWakes[SCREEN_WAKE_STATS];
+const Screen *wakeScreen;
+
+void recordWake(uint64_t elapsed) {
+  WakeStats &w = wakeStats[wakeType];
+  w.wakes++;
+  w.wakeMicros += elapsed;
+  const uint32_t panelInit = display.panelInitMicros();
+  if (panelInit > 0) {
+    w.panelInits++;
+    w.panelInitMicros += panelInit;
+  }
+  for (uint8_t i = 0; i < WAKE_TYPES; i++) {
+    const WakeStats &s = wakeStats[i];
+    if (s.wakes == 0) {
+      continue;
+    }
+    log_i("%s: %u wakes avg %llu us, %u woke the panel, init avg %llu us",
+          wakeTypeNames[i], s.wakes, s.wakeMicros / s.wakes, s.panelInits,
+          s.panelInits ? s.panelInitMicros / s.panelInits : 0);
+  }
+  if (wakeScreen == nullptr) {
+    return;
+  }
+  for (ScreenWakes &s : screenWakes) {
+    if ((s.screen == wakeScreen) || (s.screen == nullptr)) {
+      s.screen = wakeScreen;
+      s.wakes[wakeType]++;
+      log_i("screen %p: %u timer, %u button, %u other wakes", s.screen,
+            s.wakes[WAKE_TIMER], s.wakes[WAKE_BUTTON], s.wakes[WAKE_OTHER]);
+      return;
+    }
+  }
+  log_w("screen %p: wake not counted, all %d SCREEN_WAKE_STATS are taken",
+        wakeScreen, SCREEN_WAKE_STATS);
+}
+
 void initTime(String datetime) {
   static bool done;
   if (done) { return; }
@@ -115,8 +188,77 @@ void initTime(String datetime) {
   done = true;
 }
 
+const gpio_num_t buttonPins[] = {
+    gpio_num_t(MENU_BTN_PIN), gpio_num_t(BACK_BTN_PIN), gpio_num_t(UP_BTN_PIN),
+    gpio_num_t(DOWN_BTN_PIN)};
+const uint8_t numButtons = sizeof(buttonPins) / sizeof(buttonPins[0]);
+// time spent light sleeping between fast frames, and since when
+uint64_t lightSleepMicros;
+uint64_t fastSince;
+uint32_t fastFrames;
+
+// light sleep for ticks, or until a button is pressed. Returns true if it
+// slept the whole time, false if it was woken by a button or didn't sleep at
+// all because there's an event to handle or a button is down (the button
+// interrupt sends its release).
+bool lightSleep(TickType_t ticks) {
+  if (Watchy_Event::Event::wait(0)) {
+    return false;
+  }
+  for (const gpio_num_t pin : buttonPins) {
+    if (gpio_get_level(pin)) {
+      return false;
+    }
+  }
+  // a GPIO wakeup takes over the pin's interrupt type, so the button's edge
+  // interrupt is switched off while we sleep and put back afterwards
+  uint32_t pinConfig[numButtons];
+  for (uint8_t i = 0; i < numButtons; i++) {
+    pinConfig[i] = GPIO.pin[buttonPins[i]].val;
+    GPIO.pin[buttonPins[i]].int_ena = 0;
+    gpio_wakeup_enable(buttonPins[i], GPIO_INTR_HIGH_LEVEL);
+  }
+  esp_sleep_enable_gpio_wakeup();
+  esp_sleep_enable_timer_wakeup(uint64_t(ticks) * portTICK_PERIOD_MS * 1000);
+  const uint64_t before = micros();
+  esp_light_sleep_start();
+  lightSleepMicros += micros() - before;
+  const bool slept = (esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_TIMER);
+  // or deep sleep would be woken by them too
+  esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_TIMER);
+  esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_GPIO);
+  // the press that woke us came while the edge interrupts were off, so it
+  // has to be picked up here, before their status is cleared
+  WatchyInterrupts::pollButtons();
+  for (uint8_t i = 0; i < numButtons; i++) {
+    gpio_wakeup_disable(buttonPins[i]);
+    GPIO.pin[buttonPins[i]].val = pinConfig[i];
+    if (buttonPins[i] < 32) {
+      GPIO.status_w1tc = 1UL << buttonPins[i];
+    } else {
+      GPIO.status1_w1tc.intr_st = 1UL << (buttonPins[i] - 32);
+    }
+  }
+  return slept;
+}
+
+// the share of the time a fast refreshing screen keeps the chip awake. 100%
+// if it doesn't light sleep between frames.
+void recordFastFrame() {
+  const uint64_t t = micros();
+  if (fastFrames++ == 0) {
+    fastSince = t;
+    lightSleepMicros = 0;
+  }
+  if (fastFrames % (10 * FAST_REFRESH_HZ) == 0) {
+    log_i("%u fast frames, awake %llu%%", fastFrames,
+          100 - lightSleepMicros * 100 / (t - fastSince));
+  }
+}
+
 void init() {
   start = micros();
+  wakeScreen = screen;
   Watchy_Event::BackgroundTask initTask("init", nullptr);
   initTask.add();
   esp_sleep_wakeup_cause_t wakeup_reason =
@@ -124,24 +266,24 @@ void init() {
   log_i("reason %s", wakeupReasonToString(wakeup_reason));
   initTime();
 
-  for (auto &&owc : owcVec) {
+  for (auto &&owc : owcVec()) {
     owc(wakeup_reason);
   }
 
   switch (wakeup_reason) {
     case ESP_SLEEP_WAKEUP_TIMER:  // ESP Internal RTC
-      Watchy_Event::Event{
-          .id = Watchy_Event::ALARM_TIMER,
-          .micros = micros(),
-      }.send();
+      // only set for a Watchy_Timer, which redraws the screen if it needs to
+      wakeType = WAKE_TIMER;
       break;
     case ESP_SLEEP_WAKEUP_EXT0:  // RTC Alarm
+      wakeType = WAKE_TIMER;
       Watchy_Event::Event{
           .id = Watchy_Event::ALARM_TIMER,
           .micros = micros(),
       }.send();
       break;
     case ESP_SLEEP_WAKEUP_EXT1:  // button Press
+      wakeType = WAKE_BUTTON;
       handleButtonPress();
       break;
     default:  // reset
@@ -151,23 +293,78 @@ void init() {
   }
   initTask.remove();
   for (;;) {
+    Watchy_Timer::Timer::runDue();
     Watchy_Event::Event::handleAll();
-    if (!Watchy_Event::BackgroundTask::running()) {
-      if (RTC.refresh() != RTC_REFRESH_FAST) {
-        break;
+    // a button being held down will repeat
+    if (!Watchy_Event::BackgroundTask::running() &&
+        (RTC.refresh() != RTC_REFRESH_FAST) &&
+        !WatchyInterrupts::anyButtonDown()) {
+      break;
+    }
+    // block, with the CPU free to idle, until there is an event (the last
+    // background task finishing sends one) or the screen is due a redraw.
+    // With nothing running but a fast refreshing screen, light sleep.
+    const bool fast = (RTC.refresh() == RTC_REFRESH_FAST);
+    const bool idle = !Watchy_Event::BackgroundTask::running();
+    if ((fast && idle && FAST_REFRESH_LIGHT_SLEEP &&
+         lightSleep(ticksToNextRefresh())) ||
+        !Watchy_Event::Event::wait(ticksToNextRefresh())) {
+      markDirty();
+      if (fast) {
+        recordFastFrame();
       }
-      showWatchFace(true);
     }
   }
+  drawIfDirty();  // a background task may have finished since the last pass
   Watchy::deepSleep();
 }
 
+// how long until the screen is due a redraw, while we're awake anyway
+TickType_t ticksToNextRefresh() {
+  timeval tv;
+  gettimeofday(&tv, nullptr);
+  const uint32_t ms = tv.tv_usec / 1000;
+  switch (RTC.refresh()) {
+    case RTC_REFRESH_SEC:
+      return pdMS_TO_TICKS(1000 - ms);
+    case RTC_REFRESH_MIN:
+      return pdMS_TO_TICKS((SECS_PER_MIN - tv.tv_sec % SECS_PER_MIN) * 1000 -
+                           ms);
+    case RTC_REFRESH_FAST: {
+      const uint32_t period = 1000 / FAST_REFRESH_HZ;
+      return pdMS_TO_TICKS(period - millis() % period);
+    }
+    default:
+      return portMAX_DELAY;
+  }
+}
+
 void deepSleep() {
+  prepareNextFrame();
+  if (screen != nullptr) {
+    screen->beforeSleep();  // while the panel is still refreshing
+  }
+  display.hibernate();  // waits for the refresh task
+  if ((RTC.refresh() == RTC_REFRESH_ALARM) && (screen != nullptr)) {
+    // the screen changes at this time, a couple of seconds late if it
+    // would be gone by the time we sleep
+    const time_t t = screen->nextChange(now());
+    RTC.setAlarm(t == 0 ? 0 : max(t, time_t(now() + 2)));
+  }
   uint64_t elapsed = micros() - start;
-  display.hibernate();
+  recordWake(elapsed);
   esp_sleep_enable_ext1_wakeup(
       BTN_PIN_MASK,
       ESP_EXT1_WAKEUP_ANY_HIGH);  // enable deep sleep wake on button press
+  // a screen that ticks runs the due timers on its ticks, otherwise wake for
+  // the next one
+  const time_t next = Watchy_Timer::Timer::next();
+  if ((next != 0) && (RTC.refresh() != RTC_REFRESH_MIN) &&
+      (RTC.refresh() != RTC_REFRESH_SEC)) {
+    const time_t t = now();
+    esp_sleep_enable_timer_wakeup(uint64_t(next > t ? next - t : 1) * 1000000);
+    log_d("timer wake in %lds", long(next - t));
+  }
   log_i("%6d *** sleeping after %llu.%03llums ***\n", millis(), elapsed / 1000,
         elapsed % 1000);
   esp_deep_sleep_start();
@@ -175,22 +372,151 @@ void deepSleep() {
 
 void showWatchFace(bool partialRefresh, Screen *s) {
   display.init(0, false);  //_initial_refresh to false to prevent full update on init
-  display.setFullWindow();
   display.setTextColor((s->bgColor == GxEPD_WHITE ? GxEPD_BLACK : GxEPD_WHITE));
   display.setCursor(0, 0);
   s->show();
-  display.display(partialRefresh);  // partial refresh
+  drawn = s;
+  // partial refresh of what changed, on the refresh task so that events keep
+  // being handled while the panel is busy
+  display.displayAsync(partialRefresh);
+}
+
+// a frame kept in RTC memory over deep sleep. Either the frame the screen
+// will show on the next minute (or second) tick, drawn just before going to
+// sleep so that the tick only has to send it, or, for a screen that doesn't
+// tick, the frame it's showing, so that it can redraw just what changes on
+// the next wake. 1536 bytes holds a packed TimeScreen frame with room to
+// spare.
+RTC_DATA_ATTR uint8_t preparedFrame[1536];
+RTC_DATA_ATTR uint16_t preparedFrameSize;  // 0 if there isn't one
+RTC_DATA_ATTR time_t preparedFrameTime;  // 0 if it's the frame being shown
+RTC_DATA_ATTR time_t preparedFrameEnd;   // the next change after that, or 0
+RTC_DATA_ATTR const Screen *preparedFrameScreen;
+
+void prepareNextFrame() {
+  preparedFrameSize = 0;
+  if (screen == nullptr) {
+    return;
+  }
+  time_t t = 0;
+  time_t end = 0;  // when the frame at t changes again, 0 if never
+  switch (RTC.refresh()) {
+    case RTC_REFRESH_MIN:
+      t = (now() / SECS_PER_MIN + 1) * SECS_PER_MIN;
+      end = t + SECS_PER_MIN;
+      break;
+    case RTC_REFRESH_SEC:
+      t = now() + 1;
+      end = t + 1;
+      break;
+    case RTC_REFRESH_ALARM:
+      t = screen->nextChange(now());
+      end = (t != 0) ? screen->nextChange(t) : 0;
+      break;
+    default:
+      break;
+  }
+  if (t != 0) {
+    // same setup as showWatchFace
+    display.setTextColor(
+        (screen->bgColor == GxEPD_WHITE ? GxEPD_BLACK : GxEPD_WHITE));
+    display.setCursor(0, 0);
+    if (screen->showAt(t)) {
+      drawn = screen;
+    } else {
+      t = 0;
+    }
+  }
+  if ((t == 0) && (drawn != screen)) {
+    return;  // nothing worth keeping
+  }
+  preparedFrameSize = display.packFrame(preparedFrame, sizeof(preparedFrame));
+  preparedFrameTime = t;
+  preparedFrameEnd = end;
+  preparedFrameScreen = screen;
+  log_d("kept frame for %ld, %d bytes", t, preparedFrameSize);
+}
+
+bool showPreparedFrame() {
+  if (preparedFrameTime == 0) {
+    return false;  // not a prepared frame, it's already on the panel
+  }
+  const uint16_t size = preparedFrameSize;
+  preparedFrameSize = 0;  // only good for one wake
+  const time_t t = now();
+  if ((size == 0) || (preparedFrameScreen != screen) ||
+      (t < preparedFrameTime) ||
+      ((preparedFrameEnd != 0) && (t >= preparedFrameEnd))) {
+    return false;
+  }
+  if (!display.unpackFrame(preparedFrame, size)) {
+    drawn = nullptr;
+    return false;
+  }
+  drawn = screen;
+  log_d("showing prepared frame");
+  display.init(0, false);
+  display.displayAsync(!fullRefreshDue(false));
+  return true;
 }
 
 const Screen *getScreen() { return screen; }
 
+const Screen *drawnScreen() {
+  if ((drawn == nullptr) && (preparedFrameSize != 0) &&
+      (preparedFrameTime == 0) && (preparedFrameScreen == screen)) {
+    // the frame buffer didn't survive deep sleep, but the frame did
+    const uint16_t size = preparedFrameSize;
+    preparedFrameSize = 0;
+    if (display.unpackFrame(preparedFrame, size)) {
+      drawn = screen;
+    }
+  }
+  return drawn;
+}
+
 // setScreen is used to set a new screen on the display
 void setScreen(Screen *s) {
   if (s == nullptr) {
     return;
   }
   screen = s;
-  showWatchFace(true);
+  screenChanged = true;
+  markDirty();
+}
+
+// a full refresh clears ghosting but is slow and flashes the whole panel, so
+// it only happens when the screen asks for one and it won't be noticed: on a
+// screen transition, or during the quiet hour.
+bool fullRefreshDue(bool transition) {
+  if (!screen->needsFullRefresh(display.partialRefreshes(),
+                                display.partialPixels())) {
+    return false;
+  }
+  if (!transition) {
+    tm t;
+    const time_t tt = now();
+    localtime_r(&tt, &t);
+    if (t.tm_hour != FULL_REFRESH_QUIET_HOUR) {
+      return false;
+    }
+  }
+  log_i("full refresh after %d partial refreshes, %u pixels",
+        display.partialRefreshes(), display.partialPixels());
+  return true;
+}
+
+void markDirty() { dirty = true; }
+
+bool drawIfDirty() {
+  if (!dirty || screen == nullptr) {
+    return false;
+  }
+  dirty = false;  // before drawing, so a change made while drawing isn't lost
+  const bool transition = screenChanged;
+  screenChanged = false;
+  showWatchFace(!fullRefreshDue(transition));
+  return true;
 }
 
 // This mutex protects the WiFi object, wifiConnectionCount
@@ -1,7 +1,6 @@
 #pragma once
 
 #include <Arduino.h>
-#include <GxEPD2_BW.h>
 #include <HTTPClient.h>
 #include <TimeLib.h>
 #include <Wire.h>
@@ -11,13 +10,14 @@
 #include "bma.h"
 #include "config.h"
 #include "Events.h"
+#include "WatchyDisplay.h"
 #include "WatchyRTC.h"
 
 class Screen;
 
 namespace Watchy {
 extern WatchyRTC RTC;
-extern GxEPD2_BW<GxEPD2_154_D67, GxEPD2_154_D67::HEIGHT> display;
+extern WatchyDisplay display;
 extern tmElements_t currentTime;
 extern Screen *screen;
 void init();
@@ -36,7 +36,20 @@ bool getWiFi();
 void releaseWiFi();
 
 void showWatchFace(bool partialRefresh, Screen *s = Watchy::screen);
+// the screen isn't drawn straight away, it's marked dirty and drawn once
+// after all the pending events have been handled. So a burst of button
+// presses only draws and refreshes the panel once, for the final state.
 void setScreen(Screen *s);
+void markDirty();
+bool drawIfDirty();  // partial refresh if marked dirty, returns true if drawn
+// sends the frame drawn for this minute before the last deep sleep, if there
+// is one and it's still right. Returns false if the screen has to be drawn.
+bool showPreparedFrame();
+// the screen that drew what's in the frame buffer, or nullptr if nobody has
+// this wake. A screen that finds its own last frame there can redraw just
+// what changed. The frame the screen was showing when we went to sleep is
+// kept, and put back in the frame buffer the first time this is asked.
+const Screen *drawnScreen();
 
 // stored in RTC_DATA_ATTR
 extern BMA423 sensor;
@@ -0,0 +1,531 @@
+#include "WatchyDisplay.h"
+
+#include "Events.h"
+
+// keeps us from deep sleeping while there are frames to send. Never actually
+// run as a background task.
+Watchy_Event::BackgroundTask refreshMarker("refresh", nullptr);
+
+RTC_DATA_ATTR uint32_t WatchyDisplay::_tileHash[TILES_Y][TILES_X];
+RTC_DATA_ATTR bool WatchyDisplay::_tileHashValid = false;
+RTC_DATA_ATTR bool WatchyDisplay::_panelAsleep = false;
+RTC_DATA_ATTR uint16_t WatchyDisplay::_partialRefreshes = 0;
+RTC_DATA_ATTR uint32_t WatchyDisplay::_partialPixels = 0;
+
+WatchyDisplay::WatchyDisplay(GxEPD2_154_D67 epd2_instance)
+    : Adafruit_GFX(GxEPD2_154_D67::WIDTH, GxEPD2_154_D67::HEIGHT),
+      epd2(epd2_instance),
+      _serialDiagBitrate(0),
+      _initial(true),
+      _initPending(false),
+      _initialized(false),
+      _panelInitMicros(0),
+      _pendingPartial(false),
+      _pendingLock(nullptr),
+      _refreshEvents(nullptr),
+      _refreshTask(nullptr) {
+  fillScreen(GxEPD_WHITE);
+}
+
+void WatchyDisplay::init(uint32_t serial_diag_bitrate, bool initial) {
+  if (_initialized) {
+    return;
+  }
+  _serialDiagBitrate = serial_diag_bitrate;
+  _initial = initial;
+  _initPending = true;
+}
+
+// the panel gets a full reset and init every wake it's needed. Whether what's
+// on it is still known is decided in _send(), from _panelAsleep.
+void WatchyDisplay::_initPanel() {
+  if (!_initPending) {
+    return;
+  }
+  const uint32_t start = micros();
+  epd2.init(_serialDiagBitrate, _initial);
+  _panelAsleep = false;  // until hibernate() says otherwise
+  _panelInitMicros = micros() - start;
+  _initPending = false;
+  _initialized = true;
+}
+
+void WatchyDisplay::drawPixel(int16_t x, int16_t y, uint16_t color) {
+#ifdef WATCHY_BENCH
+  stats.pixels++;
+#endif
+  if ((x < 0) || (x >= width()) || (y < 0) || (y >= height())) {
+    return;
+  }
+  // check rotation, move pixel around if necessary
+  switch (getRotation()) {
+    case 1:
+      _swap_int16_t(x, y);
+      x = WIDTH - x - 1;
+      break;
+    case 2:
+      x = WIDTH - x - 1;
+      y = HEIGHT - y - 1;
+      break;
+    case 3:
+      _swap_int16_t(x, y);
+      y = HEIGHT - y - 1;
+      break;
+  }
+  uint8_t &b = _buffer[x / 8 + y * WIDTH_BYTES];
+  if (color) {
+    b |= 0x80 >> (x % 8);
+  } else {
+    b &= ~(0x80 >> (x % 8));
+  }
+}
+
+void WatchyDisplay::fillScreen(uint16_t color) {
+  memset(_buffer, color ? 0xFF : 0x00, sizeof(_buffer));
+}
+
+void WatchyDisplay::drawFastHLine(int16_t x, int16_t y, int16_t w,
+                                  uint16_t color) {
+  if (getRotation() != 0) {
+    Adafruit_GFX::drawFastHLine(x, y, w, color);
+    return;
+  }
+  if (w < 0) {
+    x += w + 1;
+    w = -w;
+  }
+  _fillSpan(x, y, w, color);
+}
+
+void WatchyDisplay::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                             uint16_t color) {
+  if (getRotation() != 0) {
+    Adafruit_GFX::fillRect(x, y, w, h, color);
+    return;
+  }
+  const int16_t y1 = min(int16_t(y + h), HEIGHT);
+  for (y = max(y, int16_t(0)); y < y1; y++) {
+    _fillSpan(x, y, w, color);
+  }
+}
+
+// fill w pixels of row y starting at x, in unrotated coordinates. Writes whole
+// bytes where it can, and masks the partial bytes at either end.
+void WatchyDisplay::_fillSpan(int16_t x, int16_t y, int16_t w,
+                              uint16_t color) {
+#ifdef WATCHY_BENCH
+  stats.spans++;
+#endif
+  if ((y < 0) || (y >= HEIGHT)) {
+    return;
+  }
+  if (x < 0) {
+    w += x;
+    x = 0;
+  }
+  if (x + w > WIDTH) {
+    w = WIDTH - x;
+  }
+  if (w <= 0) {
+    return;
+  }
+  uint8_t *p = &_buffer[x / 8 + y * WIDTH_BYTES];
+  const uint8_t fill = color ? 0xFF : 0x00;
+  const uint8_t lead = x % 8;
+  if (lead != 0) {
+    uint8_t mask = 0xFF >> lead;
+    if (lead + w < 8) {
+      mask &= ~(0xFF >> (lead + w));
+    }
+    *p = (*p & ~mask) | (fill & mask);
+    w -= 8 - lead;
+    p++;
+  }
+  if (w >= 8) {
+    memset(p, fill, w / 8);
+    p += w / 8;
+  }
+  if (w > 0 && w % 8 != 0) {
+    const uint8_t mask = ~(0xFF >> (w % 8));
+    *p = (*p & ~mask) | (fill & mask);
+  }
+}
+
+// same cursor, newline and wrapping behaviour as Adafruit_GFX::write
+size_t WatchyDisplay::write(uint8_t c) {
+  if (!gfxFont || (getRotation() != 0) || (textsize_x != 1) ||
+      (textsize_y != 1)) {
+    return Adafruit_GFX::write(c);
+  }
+  if (c == '\n') {
+    cursor_x = 0;
+    cursor_y += gfxFont->yAdvance;
+    return 1;
+  }
+  if ((c == '\r') || (c < gfxFont->first) || (c > gfxFont->last)) {
+    return 1;
+  }
+  const GFXglyph &g = gfxFont->glyph[c - gfxFont->first];
+  if ((g.width > 0) && (g.height > 0)) {
+    if (wrap && ((cursor_x + g.xOffset + g.width) > _width)) {
+      cursor_x = 0;
+      cursor_y += gfxFont->yAdvance;
+    }
+    _blitGlyph(cursor_x + g.xOffset, cursor_y + g.yOffset, g.width, g.height,
+               &gfxFont->bitmap[g.bitmapOffset], textcolor);
+  }
+  cursor_x += g.xAdvance;
+  return 1;
+}
+
+// glyph bitmaps are packed MSB first with no padding between rows, so each
+// row starts at an arbitrary bit. Every 8 bits of a row are gathered into a
+// byte and shifted into place across the two frame buffer bytes they cover.
+// The panel is a whole number of bytes wide, so clipping whole bytes clips
+// exactly at the edges.
+void WatchyDisplay::_blitGlyph(int16_t x, int16_t y, uint8_t w, uint8_t h,
+                               const uint8_t *bitmap, uint16_t color) {
+#ifdef WATCHY_BENCH
+  stats.glyphs++;
+#endif
+  uint16_t bit = 0;
+  for (uint8_t yy = 0; yy < h; yy++, y++, bit += w) {
+    if ((y < 0) || (y >= HEIGHT)) {
+      continue;
+    }
+    uint8_t *row = &_buffer[y * WIDTH_BYTES];
+    for (uint8_t xx = 0; xx < w; xx += 8) {
+      const uint16_t b = bit + xx;
+      const uint8_t n = min(8, w - xx);
+      uint8_t bits = bitmap[b / 8] << (b % 8);
+      if (b % 8 + n > 8) {
+        bits |= bitmap[b / 8 + 1] >> (8 - b % 8);
+      }
+      bits &= 0xFF << (8 - n);
+      // dx >> 3 and dx & 7 round towards -infinity for negative dx
+      const int16_t dx = x + xx;
+      const uint16_t span = bits << (8 - (dx & 7));
+      const uint8_t masks[2] = {uint8_t(span >> 8), uint8_t(span)};
+      for (int16_t i = dx >> 3, j = 0; j < 2; i++, j++) {
+        if ((masks[j] == 0) || (i < 0) || (i >= WIDTH_BYTES)) {
+          continue;
+        }
+        if (color) {
+          row[i] |= masks[j];
+        } else {
+          row[i] &= ~masks[j];
+        }
+      }
+    }
+  }
+}
+
+void WatchyDisplay::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
+                               int16_t w, int16_t h, uint16_t color) {
+  if (getRotation() != 0) {
+    Adafruit_GFX::drawBitmap(x, y, bitmap, w, h, color);
+    return;
+  }
+  _blitBitmap(x, y, bitmap, w, h, color, color, false);
+}
+
+void WatchyDisplay::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
+                               int16_t w, int16_t h, uint16_t color,
+                               uint16_t bg) {
+  if (getRotation() != 0) {
+    Adafruit_GFX::drawBitmap(x, y, bitmap, w, h, color, bg);
+    return;
+  }
+  _blitBitmap(x, y, bitmap, w, h, color, bg, true);
+}
+
+// every frame buffer byte the bitmap covers is built from the one or two
+// bitmap bytes it overlaps, and merged in under a mask of the pixels the
+// bitmap covers. A transparent bitmap only sets its 1 bits to color, an
+// opaque one sets its 0 bits to bg as well. In an opaque white on black
+// bitmap the bits are the frame buffer's, so byte aligned rows are copied.
+void WatchyDisplay::_blitBitmap(int16_t x, int16_t y, const uint8_t *bitmap,
+                                int16_t w, int16_t h, uint16_t color,
+                                uint16_t bg, bool opaque) {
+  if ((w <= 0) || (h <= 0)) {
+    return;
+  }
+  const int16_t byteWidth = (w + 7) / 8;
+  // dx >> 3 and dx & 7 round towards -infinity for negative dx
+  const int16_t first = max(x >> 3, 0);
+  const int16_t last = min((x + w - 1) >> 3, WIDTH_BYTES - 1);
+  const bool copy = opaque && color && !bg && ((x & 7) == 0);
+  for (int16_t j = max(int16_t(0), int16_t(-y)); (j < h) && (y + j < HEIGHT);
+       j++) {
+    const uint8_t *src = &bitmap[j * byteWidth];
+    uint8_t *row = &_buffer[(y + j) * WIDTH_BYTES];
+    int16_t i = first;
+    if (copy) {
+      // the frame buffer bytes the bitmap covers completely
+      const int16_t n = min(int16_t(last + 1), int16_t((x + w) >> 3)) - i;
+      if (n > 0) {
+        memcpy(&row[i], &src[i - (x >> 3)], n);
+        i += n;
+      }
+    }
+    for (; i <= last; i++) {
+      const int16_t s = i * 8 - x;  // bitmap pixel at the left of byte i
+      const int16_t k = s >> 3;
+      const uint8_t r = s & 7;
+      const uint8_t hi = (k >= 0) ? src[k] : 0;
+      const uint8_t lo = (r != 0) && (k + 1 < byteWidth) ? src[k + 1] : 0;
+      uint8_t mask = 0xFF;
+      if (s < 0) {
+        mask >>= -s;
+      }
+      if (s + 8 > w) {
+        mask &= 0xFF << (s + 8 - w);
+      }
+      const uint8_t bits = ((hi << r) | (lo >> (8 - r))) & mask;
+      if (opaque) {
+        const uint8_t value = (color ? bits : 0) | (bg ? ~bits : 0);
+        row[i] = (row[i] & ~mask) | (value & mask);
+      } else if (color) {
+        row[i] |= bits;
+      } else {
+        row[i] &= ~bits;
+      }
+    }
+  }
+}
+
+void WatchyDisplay::display(bool partial_update_mode) {
+  displayAsync(partial_update_mode);
+  waitForRefresh();
+}
+
+void WatchyDisplay::displayAsync(bool partial_update_mode) {
+  if (_refreshTask == nullptr) {
+    _pendingLock = xSemaphoreCreateMutex();
+    _refreshEvents = xEventGroupCreate();
+    xEventGroupSetBits(_refreshEvents, IDLE);
+    xTaskCreatePinnedToCore(_refreshLoop, "refresh", 4096, this, 1,
+                            &_refreshTask, 1);
+    configASSERT(_refreshTask);
+  }
+  xSemaphoreTake(_pendingLock, portMAX_DELAY);
+  const EventBits_t bits = xEventGroupGetBits(_refreshEvents);
+  if (bits & FRAME_PENDING) {
+    log_d("frame superseded before it was sent");
+    // a full refresh that hasn't happened yet still has to happen
+    _pendingPartial = _pendingPartial && partial_update_mode;
+  } else {
+    _pendingPartial = partial_update_mode;
+  }
+  memcpy(_pending, _buffer, BUFFER_SIZE);
+  if (bits & IDLE) {
+    refreshMarker.add();
+  }
+  xEventGroupClearBits(_refreshEvents, IDLE);
+  xEventGroupSetBits(_refreshEvents, FRAME_PENDING);
+  xSemaphoreGive(_pendingLock);
+}
+
+void WatchyDisplay::waitForRefresh() {
+  if (_refreshTask == nullptr) {
+    return;  // nothing was ever sent
+  }
+  xEventGroupWaitBits(_refreshEvents, IDLE, pdFALSE, pdTRUE, portMAX_DELAY);
+}
+
+// body of the refresh task. Sends the most recent pending frame, until there
+// aren't any.
+void WatchyDisplay::_refreshLoop(void *p) {
+  WatchyDisplay *d = static_cast<WatchyDisplay *>(p);
+  for (;;) {
+    xEventGroupWaitBits(d->_refreshEvents, FRAME_PENDING, pdFALSE, pdTRUE,
+                        portMAX_DELAY);
+    xSemaphoreTake(d->_pendingLock, portMAX_DELAY);
+    xEventGroupClearBits(d->_refreshEvents, FRAME_PENDING);
+    memcpy(d->_sending, d->_pending, BUFFER_SIZE);
+    const bool partial = d->_pendingPartial;
+    xSemaphoreGive(d->_pendingLock);
+
+    d->_send(d->_sending, partial);
+
+    xSemaphoreTake(d->_pendingLock, portMAX_DELAY);
+    if (!(xEventGroupGetBits(d->_refreshEvents) & FRAME_PENDING)) {
+      refreshMarker.remove();
+      xEventGroupSetBits(d->_refreshEvents, IDLE);
+    }
+    xSemaphoreGive(d->_pendingLock);
+  }
+}
+
+void WatchyDisplay::_send(const uint8_t *frame, bool partial_update_mode) {
+  if (!partial_update_mode) {
+    _initPanel();
+    epd2.writeImage(frame, 0, 0, WIDTH, HEIGHT);
+    epd2.refresh(false);
+    epd2.writeImageAgain(frame, 0, 0, WIDTH, HEIGHT);
+    epd2.powerOff();
+    _updateTileHashes(frame);
+    _partialRefreshes = 0;
+    _partialPixels = 0;
+    return;
+  }
+  if (!_initialized && !_panelAsleep) {
+    // the panel wasn't hibernated after its last refresh (first boot, or a
+    // crash with it awake), so what's on it isn't known. Decided before the
+    // damage is worked out from the tile hashes.
+    _tileHashValid = false;
+  }
+  int16_t x, y, w, h;
+  if (!_damage(frame, x, y, w, h)) {
+    log_d("frame unchanged, skipping refresh");
+    return;
+  }
+  log_d("refresh %d,%d %dx%d", x, y, w, h);
+  _sendWindow(frame, x, y, w, h);
+  if (_partialRefreshes < UINT16_MAX) {
+    _partialRefreshes++;
+  }
+  _partialPixels += uint32_t(w) * h;
+}
+
+void WatchyDisplay::_sendWindow(const uint8_t *frame, int16_t x, int16_t y,
+                                int16_t w, int16_t h) {
+  _initPanel();
+  epd2.writeImagePart(frame, x, y, WIDTH, HEIGHT, x, y, w, h);
+  epd2.refresh(x, y, w, h);
+  epd2.writeImagePartAgain(frame, x, y, WIDTH, HEIGHT, x, y, w, h);
+}
+
+void WatchyDisplay::hibernate() {
+  waitForRefresh();
+  if (!_initialized) {
+    return;  // never woke the panel up, it's still hibernating
+  }
+  epd2.hibernate();
+  _initialized = false;
+  _panelAsleep = true;
+}
+
+// PackBits: a header byte of 0..127 is followed by that many plus one literal
+// bytes, -127..-1 by one byte repeated 1 - header times. -128 is unused. The
+// frame is packed a column of bytes at a time, top to bottom, which packs
+// text about a third smaller than going row by row.
+static inline size_t columnMajor(size_t i) {
+  return (i % GxEPD2_154_D67::HEIGHT) * WatchyDisplay::WIDTH_BYTES +
+         i / GxEPD2_154_D67::HEIGHT;
+}
+
+size_t WatchyDisplay::packFrame(uint8_t *out, size_t max) const {
+  size_t o = 0;
+  for (size_t i = 0; i < BUFFER_SIZE;) {
+    const uint8_t b = _buffer[columnMajor(i)];
+    size_t n = 1;
+    while ((i + n < BUFFER_SIZE) && (n < 128) &&
+           (_buffer[columnMajor(i + n)] == b)) {
+      n++;
+    }
+    if (n >= 2) {
+      if (o + 2 > max) {
+        return 0;
+      }
+      out[o++] = uint8_t(1 - n);
+      out[o++] = b;
+      i += n;
+      continue;
+    }
+    // literal bytes, up to the next run that is worth breaking them for
+    while ((i + n < BUFFER_SIZE) && (n < 128) &&
+           !((i + n + 2 < BUFFER_SIZE) &&
+             (_buffer[columnMajor(i + n)] == _buffer[columnMajor(i + n + 1)]) &&
+             (_buffer[columnMajor(i + n)] == _buffer[columnMajor(i + n + 2)]))) {
+      n++;
+    }
+    if (o + 1 + n > max) {
+      return 0;
+    }
+    out[o++] = uint8_t(n - 1);
+    for (; n > 0; n--) {
+      out[o++] = _buffer[columnMajor(i++)];
+    }
+  }
+  return o;
+}
+
+bool WatchyDisplay::unpackFrame(const uint8_t *in, size_t n) {
+  size_t o = 0;
+  for (size_t i = 0; i < n;) {
+    const int8_t header = in[i++];
+    if (header >= 0) {
+      const size_t count = header + 1;
+      if ((i + count > n) || (o + count > BUFFER_SIZE)) {
+        return false;
+      }
+      for (size_t j = 0; j < count; j++) {
+        _buffer[columnMajor(o++)] = in[i++];
+      }
+    } else if (header != -128) {
+      const size_t count = 1 - header;
+      if ((i >= n) || (o + count > BUFFER_SIZE)) {
+        return false;
+      }
+      for (size_t j = 0; j < count; j++) {
+        _buffer[columnMajor(o++)] = in[i];
+      }
+      i++;
+    }
+  }
+  return o == BUFFER_SIZE;
+}
+
+// FNV-1a
+uint32_t WatchyDisplay::_hashTile(const uint8_t *frame, uint16_t tx,
+                                 uint16_t ty) {
+  uint32_t hash = 2166136261u;
+  const uint8_t *row =
+      &frame[ty * TILE_HEIGHT * WIDTH_BYTES + tx * TILE_WIDTH / 8];
+  for (uint16_t y = 0; y < TILE_HEIGHT; y++, row += WIDTH_BYTES) {
+    for (uint16_t x = 0; x < TILE_WIDTH / 8; x++) {
+      hash = (hash ^ row[x]) * 16777619u;
+    }
+  }
+  return hash;
+}
+
+// computes the bounding box of all the tiles of frame that differ from what is
+// on the panel, and records the new tiles as being on the panel. Returns false if
+// nothing changed.
+bool WatchyDisplay::_damage(const uint8_t *frame, int16_t &x, int16_t &y,
+                            int16_t &w, int16_t &h) {
+  int16_t minX = TILES_X, minY = TILES_Y, maxX = -1, maxY = -1;
+  for (uint16_t ty = 0; ty < TILES_Y; ty++) {
+    for (uint16_t tx = 0; tx < TILES_X; tx++) {
+      const uint32_t hash = _hashTile(frame, tx, ty);
+      if (_tileHashValid && hash == _tileHash[ty][tx]) {
+        continue;
+      }
+      _tileHash[ty][tx] = hash;
+      minX = min(minX, int16_t(tx));
+      minY = min(minY, int16_t(ty));
+      maxX = max(maxX, int16_t(tx));
+      maxY = max(maxY, int16_t(ty));
+    }
+  }
+  _tileHashValid = true;
+  if (maxX < 0) {
+    return false;
+  }
+  x = minX * TILE_WIDTH;
+  y = minY * TILE_HEIGHT;
+  w = (maxX - minX + 1) * TILE_WIDTH;
+  h = (maxY - minY + 1) * TILE_HEIGHT;
+  return true;
+}
+
+void WatchyDisplay::_updateTileHashes(const uint8_t *frame) {
+  for (uint16_t ty = 0; ty < TILES_Y; ty++) {
+    for (uint16_t tx = 0; tx < TILES_X; tx++) {
+      _tileHash[ty][tx] = _hashTile(frame, tx, ty);
+    }
+  }
+  _tileHashValid = true;
+}
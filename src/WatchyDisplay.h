@@ -0,0 +1,137 @@
+#pragma once
+
+#include <Adafruit_GFX.h>
+#include <GxEPD2_BW.h>
+#include <freertos/event_groups.h>
+#include <freertos/semphr.h>
+
+// Full screen 1 bit per pixel frame buffer in front of the Watchy e-paper
+// panel. Takes the place of GxEPD2_BW so that we own the frame buffer.
+//
+// The frame buffer is split into tiles. A hash of every tile that is on the
+// panel is kept in RTC memory, so on a partial refresh only the bounding box
+// of the tiles that actually changed gets sent and refreshed, even across
+// deep sleep. If nothing changed the panel isn't touched at all, not even
+// initialized.
+//
+// Frames are sent to the panel by a refresh task, so drawing and event
+// handling carry on while the panel is busy. A frame handed over while
+// another one is still being sent waits its turn, and is replaced if a newer
+// one is handed over before it gets sent. Only the refresh task touches the
+// panel.
+class WatchyDisplay : public Adafruit_GFX {
+ public:
+  static const uint16_t WIDTH_BYTES = GxEPD2_154_D67::WIDTH / 8;
+  static const uint16_t TILE_WIDTH = 40;  // must be a multiple of 8
+  static const uint16_t TILE_HEIGHT = 8;
+  static const uint16_t TILES_X = GxEPD2_154_D67::WIDTH / TILE_WIDTH;
+  static const uint16_t TILES_Y = GxEPD2_154_D67::HEIGHT / TILE_HEIGHT;
+
+  GxEPD2_154_D67 epd2;
+
+  WatchyDisplay(GxEPD2_154_D67 epd2_instance);
+  // the panel is only initialized once per wake, and only when there is
+  // something to send to it
+  void init(uint32_t serial_diag_bitrate = 0, bool initial = true);
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+  void fillScreen(uint16_t color) override;
+  // horizontal lines and rectangles are filled a byte at a time
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                uint16_t color) override;
+  // GFXfont text is blitted into the frame buffer a byte at a time rather than
+  // a pixel at a time. Rotated or scaled text falls back to Adafruit_GFX.
+  using Print::write;
+  size_t write(uint8_t c) override;
+  // 1 bit per pixel bitmaps, rows padded to whole bytes, are merged into the
+  // frame buffer a byte at a time, and copied straight in when they are byte
+  // aligned and already in frame buffer colors. Rotated bitmaps fall back to
+  // Adafruit_GFX.
+  using Adafruit_GFX::drawBitmap;
+  void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w,
+                  int16_t h, uint16_t color);
+  void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w,
+                  int16_t h, uint16_t color, uint16_t bg);
+  void drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h,
+                  uint16_t color) {
+    drawBitmap(x, y, (const uint8_t *)bitmap, w, h, color);
+  }
+  void drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h,
+                  uint16_t color, uint16_t bg) {
+    drawBitmap(x, y, (const uint8_t *)bitmap, w, h, color, bg);
+  }
+  // send the frame buffer to the panel. A partial refresh only updates the
+  // region that changed since the last refresh, and does nothing at all if
+  // nothing changed. Returns once the panel has been refreshed.
+  void display(bool partial_update_mode = false);
+  // same as display(), but returns as soon as the frame buffer has been
+  // copied, and sends it on the refresh task
+  void displayAsync(bool partial_update_mode = false);
+  // returns once every frame handed to the refresh task has been sent
+  void waitForRefresh();
+  void hibernate();
+  // how long waking the panel up took this wake, 0 if it wasn't woken
+  uint32_t panelInitMicros() const { return _panelInitMicros; }
+  // partial refreshes, and the pixels they refreshed, since the last full
+  // refresh. Ghosting builds up with both.
+  uint16_t partialRefreshes() const { return _partialRefreshes; }
+  uint32_t partialPixels() const { return _partialPixels; }
+  uint8_t *getBuffer() { return _buffer; }
+  // the frame buffer compressed with PackBits, for keeping a frame in RTC
+  // memory. Returns the packed size, or 0 if it doesn't fit in max bytes.
+  size_t packFrame(uint8_t *out, size_t max) const;
+  // replaces the frame buffer with a packed one. Returns false, leaving the
+  // frame buffer in an undefined state, if it isn't a whole packed frame.
+  bool unpackFrame(const uint8_t *in, size_t n);
+
+#ifdef WATCHY_BENCH
+  // how much drawing has been done, for benchmarks
+  struct Stats {
+    uint32_t pixels;  // drawPixel calls
+    uint32_t spans;   // horizontal spans filled
+    uint32_t glyphs;  // glyphs blitted
+  } stats;
+#endif
+
+ private:
+  static const size_t BUFFER_SIZE = WIDTH_BYTES * GxEPD2_154_D67::HEIGHT;
+  // event group bits
+  static const EventBits_t FRAME_PENDING = 0x01;  // _pending holds a frame
+  static const EventBits_t IDLE = 0x02;           // nothing left to send
+
+  uint8_t _buffer[BUFFER_SIZE];
+  uint32_t _serialDiagBitrate;
+  bool _initial;
+  bool _initPending;  // init() was called but the panel hasn't been yet
+  bool _initialized;  // panel has been initialized this wake
+  uint32_t _panelInitMicros;
+  uint8_t _pending[BUFFER_SIZE];  // next frame for the refresh task to send
+  uint8_t _sending[BUFFER_SIZE];  // frame the refresh task is sending
+  bool _pendingPartial;
+  SemaphoreHandle_t _pendingLock;  // protects _pending and _pendingPartial
+  EventGroupHandle_t _refreshEvents;
+  TaskHandle_t _refreshTask;
+  // hash of each tile as it is currently shown on the panel
+  static uint32_t _tileHash[TILES_Y][TILES_X];
+  static bool _tileHashValid;
+  // hibernate() put the panel to sleep after the last refresh. If not (first
+  // boot, or a crash with the panel awake) what's on it isn't known.
+  static bool _panelAsleep;
+  static uint16_t _partialRefreshes;
+  static uint32_t _partialPixels;
+
+  void _initPanel();
+  static void _refreshLoop(void *p);
+  void _send(const uint8_t *frame, bool partial_update_mode);
+  void _sendWindow(const uint8_t *frame, int16_t x, int16_t y, int16_t w,
+                   int16_t h);
+  void _fillSpan(int16_t x, int16_t y, int16_t w, uint16_t color);
+  void _blitGlyph(int16_t x, int16_t y, uint8_t w, uint8_t h,
+                  const uint8_t *bitmap, uint16_t color);
+  void _blitBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w,
+                   int16_t h, uint16_t color, uint16_t bg, bool opaque);
+  static uint32_t _hashTile(const uint8_t *frame, uint16_t tx, uint16_t ty);
+  static bool _damage(const uint8_t *frame, int16_t &x, int16_t &y, int16_t &w,
+                      int16_t &h);
+  static void _updateTileHashes(const uint8_t *frame);
+};
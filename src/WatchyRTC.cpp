@@ -39,6 +39,7 @@ void WatchyRTC::config(String datetime) {
 
 void WatchyRTC::clearAlarm() {
   if (rtcType == DS3231) {
+    rtc_ds.alarm(ALARM_1);
     rtc_ds.alarm(ALARM_2);
   } else {
     rtc_pcf.clearAlarm();  // resets the alarm flag in the RTC
@@ -89,12 +90,36 @@ void WatchyRTC::setAlarm(uint8_t minutes, uint8_t hours, uint8_t dayOfWeek) {
   }
 }
 
+void WatchyRTC::setAlarm(time_t t) {
+  log_d("setAlarm(%ld)", t);
+  tmElements_t tm;
+  if (rtcType == DS3231) {
+    if (t == 0) {
+      rtc_ds.alarmInterrupt(ALARM_1, false);
+      return;
+    }
+    breakTime(t, tm);
+    rtc_ds.setAlarm(ALM1_MATCH_HOURS, tm.Second, tm.Minute, tm.Hour, 0);
+    rtc_ds.alarm(ALARM_1);  // in case it already went off
+    rtc_ds.alarmInterrupt(ALARM_1, true);
+  } else {
+    if (t == 0) {
+      rtc_pcf.clearAlarm();
+      return;
+    }
+    breakTime(t + SECS_PER_MIN - 1, tm);  // rather late than early
+    rtc_pcf.setAlarm(tm.Minute, tm.Hour, 99, 99);
+  }
+}
+
 void WatchyRTC::setRefresh(RTC_REFRESH_t r) {
   log_d("refresh(%d)", r);
-  if ((r == RTC_REFRESH_SEC) || (r == RTC_REFRESH_MIN)) {
+  if ((r == RTC_REFRESH_SEC) || (r == RTC_REFRESH_MIN) ||
+      (r == RTC_REFRESH_ALARM)) {
     // enable wakeup interrupt
     esp_sleep_enable_ext0_wakeup(RTC_PIN, 0);
-  } else if ((refresh() == RTC_REFRESH_SEC) || (refresh() == RTC_REFRESH_MIN)) {
+  } else if ((refresh() == RTC_REFRESH_SEC) || (refresh() == RTC_REFRESH_MIN) ||
+             (refresh() == RTC_REFRESH_ALARM)) {
     // disable wakeup interrupt
     esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_EXT0);
   }
@@ -113,16 +138,20 @@ void WatchyRTC::setRefresh(RTC_REFRESH_t r) {
       case RTC_REFRESH_MIN:
         rtc_ds.setAlarm(ALM2_EVERY_MINUTE, 0, 0, 0, 0);
         rtc_ds.alarmInterrupt(2, true);
-        if (refresh() == RTC_REFRESH_SEC) {
+        if ((refresh() == RTC_REFRESH_SEC) ||
+            (refresh() == RTC_REFRESH_ALARM)) {
           rtc_ds.alarmInterrupt(1, false);
         }
         break;
-      default:  // either fast or none
+      default:  // fast, none, or alarm (set before going to sleep)
         rtc_ds.alarmInterrupt(1, false);
         rtc_ds.alarmInterrupt(2, false);
         break;
     }
   } else {
+    if (refresh() == RTC_REFRESH_ALARM) {
+      rtc_pcf.clearAlarm();
+    }
     switch (r) {
       case RTC_REFRESH_SEC:
         rtc_pcf.setTimer(1, TMR_1Hz, true);
@@ -130,7 +159,7 @@ void WatchyRTC::setRefresh(RTC_REFRESH_t r) {
       case RTC_REFRESH_MIN:
         rtc_pcf.setTimer(1, TMR_1MIN, true);
         break;
-      default:  // either fast or none
+      default:  // fast, none, or alarm (set before going to sleep)
         rtc_pcf.clearTimer();
         break;
     }
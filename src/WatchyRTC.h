@@ -10,7 +10,8 @@ enum RTC_REFRESH_t {
   RTC_REFRESH_NONE,  // never refresh, wake on buttons only
   RTC_REFRESH_SEC,   // refresh every second
   RTC_REFRESH_MIN,   // refresh every minute
-  RTC_REFRESH_FAST   // never refresh, never sleep
+  RTC_REFRESH_ALARM, // refresh when Screen::nextChange() says it changes
+  RTC_REFRESH_FAST   // refresh FAST_REFRESH_HZ times a second, never deep sleep
 };
 
 class WatchyRTC {
@@ -30,6 +31,10 @@ class WatchyRTC {
   void set(tmElements_t tm);
   uint8_t temperature();
   void setAlarm(uint8_t minutes, uint8_t hours, uint8_t dayOfWeek);
+  // alarm once at t, or a day early if it's more than a day away. The
+  // PCF8563 only has whole minutes, so it goes off at the end of t's minute.
+  // 0 cancels it.
+  void setAlarm(time_t t);
   void setRefresh(RTC_REFRESH_t r);
   RTC_REFRESH_t refresh() { return _refresh; }
 
@@ -34,6 +34,20 @@
 //display
 const int DISPLAY_WIDTH = 200;
 const int DISPLAY_HEIGHT = 200;
+// local hour when a ghosted panel can get a full refresh on a time tick,
+// because nobody is looking. See Screen::needsFullRefresh
+const int FULL_REFRESH_QUIET_HOUR = 3;
+// RTC memory for the carousel's packed neighbouring splashes, half each. A
+// packed icon splash is under 800 bytes.
+const int CAROUSEL_CACHE_BYTES = 2048;
+// frames per second of an RTC_REFRESH_FAST screen. In between the chip light
+// sleeps until the next frame or a button press, unless this is false, when
+// it stays awake like it used to (to compare the awake ratio it logs).
+const int FAST_REFRESH_HZ = 5;
+const bool FAST_REFRESH_LIGHT_SLEEP = true;
+// screens whose wakes are counted, in RTC memory. Wakes on any screen after
+// that many are only logged as not counted.
+const int SCREEN_WAKE_STATS = 8;
 
 //wifi
 constexpr const char * WIFI_AP_SSID = "Watchy AP";
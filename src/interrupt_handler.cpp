@@ -1,6 +1,7 @@
 #include "interrupt_handler.h"
 
 #include <freertos/queue.h>
+#include <freertos/timers.h>
 
 #include "Events.h"
 #include "Watchy.h"
@@ -8,7 +9,22 @@
 namespace WatchyInterrupts {
 
 #ifndef BUTTON_DEBOUNCE_US
-#define BUTTON_DEBOUNCE_US 150000
+#define BUTTON_DEBOUNCE_US 50000
+#endif
+// held down this long it's a long press, and then it repeats every
+// BUTTON_REPEAT_US, each repeat BUTTON_REPEAT_SPEEDUP/8 as long as the last,
+// down to BUTTON_REPEAT_MIN_US
+#ifndef BUTTON_LONG_PRESS_US
+#define BUTTON_LONG_PRESS_US 600000
+#endif
+#ifndef BUTTON_REPEAT_US
+#define BUTTON_REPEAT_US 200000
+#endif
+#ifndef BUTTON_REPEAT_SPEEDUP
+#define BUTTON_REPEAT_SPEEDUP 7
+#endif
+#ifndef BUTTON_REPEAT_MIN_US
+#define BUTTON_REPEAT_MIN_US 40000
 #endif
 
 static void IRAM_ATTR ISR_Send(const Watchy_Event::Event e) {
@@ -29,64 +45,102 @@ void IRAM_ATTR ISR_RTC() {
   });
 }
 
-// just use one timer for all the buttons
-static uint64_t lastIntTime = 0;
-static int bounces = 0;
+// each button has its own state, so a press on one can't be mistaken for a
+// bounce of another
+typedef struct {
+  uint8_t pin;
+  bool down;
+  uint64_t lastEdge;  // of the last press or release
+  int bounces;        // edges ignored since then
+  uint16_t repeats;   // long press and repeats sent since it went down
+  uint32_t repeatUs;  // until the next repeat
+  TimerHandle_t timer;  // runs while it's held down
+} Button;
+static Button buttons[4];
+static portMUX_TYPE buttonsMux = portMUX_INITIALIZER_UNLOCKED;
 
-void IRAM_ATTR ISR_MenuButtonPress() {
-  uint64_t t = micros() - lastIntTime;
-  lastIntTime += t;
-  if (t < BUTTON_DEBOUNCE_US) {
-    bounces++;
+// a button went down or up. Edges that don't change whether it's down, or
+// come within BUTTON_DEBOUNCE_US of the last one that did, are bounces.
+static void IRAM_ATTR ISR_Button(ButtonIndex index) {
+  Button &b = buttons[index];
+  const uint64_t t = micros();
+  const bool down = digitalRead(b.pin);
+  portENTER_CRITICAL_ISR(&buttonsMux);
+  if ((down == b.down) || (t - b.lastEdge < BUTTON_DEBOUNCE_US)) {
+    b.bounces++;
+    portEXIT_CRITICAL_ISR(&buttonsMux);
     return;
   }
-  ISR_Send(Watchy_Event::Event{
-      .id = Watchy_Event::MENU_BTN_DOWN,
-      .micros = lastIntTime,
-      {.bounces = bounces},
-  });
-}
-
-void IRAM_ATTR ISR_BackButtonPress() {
-  uint64_t t = micros() - lastIntTime;
-  lastIntTime += t;
-  if (t < BUTTON_DEBOUNCE_US) {
-    bounces++;
-    return;
+  b.down = down;
+  b.lastEdge = t;
+  const int bounces = b.bounces;
+  b.bounces = 0;
+  b.repeats = 0;
+  portEXIT_CRITICAL_ISR(&buttonsMux);
+  BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+  if (down) {
+    // (re)starts it
+    xTimerChangePeriodFromISR(b.timer,
+                              pdMS_TO_TICKS(BUTTON_LONG_PRESS_US / 1000),
+                              &xHigherPriorityTaskWoken);
+  } else {
+    xTimerStopFromISR(b.timer, &xHigherPriorityTaskWoken);
   }
   ISR_Send(Watchy_Event::Event{
-      .id = Watchy_Event::BACK_BTN_DOWN,
-      .micros = lastIntTime,
+      .id = Watchy_Event::ID(
+          (down ? Watchy_Event::MENU_BTN_DOWN : Watchy_Event::MENU_BTN_UP) +
+          index),
+      .micros = t,
       {.bounces = bounces},
   });
-}
-
-void IRAM_ATTR ISR_UpButtonPress() {
-  uint64_t t = micros() - lastIntTime;
-  lastIntTime += t;
-  if (t < BUTTON_DEBOUNCE_US) {
-    bounces++;
-    return;
+  if (xHigherPriorityTaskWoken) {
+    portYIELD_FROM_ISR();
   }
-  ISR_Send(Watchy_Event::Event{
-      .id = Watchy_Event::UP_BTN_DOWN,
-      .micros = lastIntTime,
-      {.bounces = bounces},
-  });
 }
 
-void IRAM_ATTR ISR_DownButtonPress() {
-  int64_t t = micros() - lastIntTime;
-  lastIntTime += t;
-  if (t < BUTTON_DEBOUNCE_US) {
-    bounces++;
+void IRAM_ATTR ISR_MenuButtonPress() { ISR_Button(menu_btn); }
+void IRAM_ATTR ISR_BackButtonPress() { ISR_Button(back_btn); }
+void IRAM_ATTR ISR_UpButtonPress() { ISR_Button(up_btn); }
+void IRAM_ATTR ISR_DownButtonPress() { ISR_Button(down_btn); }
+
+// runs on the timer task while a button is held down. The first time it's a
+// long press, after that it repeats faster and faster.
+static void buttonHeld(TimerHandle_t timer) {
+  const ButtonIndex index =
+      ButtonIndex(reinterpret_cast<uint32_t>(pvTimerGetTimerID(timer)));
+  Button &b = buttons[index];
+  const bool down = digitalRead(b.pin);
+  portENTER_CRITICAL(&buttonsMux);
+  if (!b.down) {
+    portEXIT_CRITICAL(&buttonsMux);
+    return;  // released since the timer went off
+  }
+  if (!down) {
+    // the release came too soon after the press and was taken for a bounce
+    b.down = false;
+    b.lastEdge = micros();
+    portEXIT_CRITICAL(&buttonsMux);
+    Watchy_Event::Event{
+        .id = Watchy_Event::ID(Watchy_Event::MENU_BTN_UP + index),
+        .micros = micros(),
+        {.bounces = 0},
+    }.send();
     return;
   }
-  ISR_Send(Watchy_Event::Event{
-      .id = Watchy_Event::DOWN_BTN_DOWN,
-      .micros = lastIntTime,
-      {.bounces = bounces},
-  });
+  const uint16_t n = b.repeats++;
+  b.repeatUs = (n == 0) ? BUTTON_REPEAT_US
+                        : max(uint32_t(BUTTON_REPEAT_MIN_US),
+                              b.repeatUs * BUTTON_REPEAT_SPEEDUP / 8);
+  const uint32_t repeatUs = b.repeatUs;
+  portEXIT_CRITICAL(&buttonsMux);
+  xTimerChangePeriod(timer, pdMS_TO_TICKS(repeatUs / 1000), 0);
+  Watchy_Event::Event{
+      .id = Watchy_Event::ID(
+          (n == 0 ? Watchy_Event::MENU_BTN_LONG : Watchy_Event::MENU_BTN_REPEAT) +
+          index),
+      .micros = micros(),
+      {.repeats = n},
+  }.send();
 }
 
 void timerSetup() {
@@ -95,21 +149,66 @@ void timerSetup() {
 
 void buttonSetup(int pin, ButtonIndex index) {
   pinMode(pin, INPUT_PULLUP);
+  Button &b = buttons[index];
+  b.pin = pin;
+  b.timer = xTimerCreate("button", pdMS_TO_TICKS(BUTTON_LONG_PRESS_US / 1000),
+                         pdFALSE, reinterpret_cast<void *>(index), buttonHeld);
+  // still held down from waking us up. The press has already been sent.
+  b.down = digitalRead(pin);
+  b.lastEdge = micros();
+  if (b.down) {
+    xTimerStart(b.timer, 0);
+  }
   switch (index) {
     case menu_btn:
-      attachInterrupt(pin, ISR_MenuButtonPress, GPIO_INTR_NEGEDGE);
+      attachInterrupt(pin, ISR_MenuButtonPress, GPIO_INTR_ANYEDGE);
       break;
     case back_btn:
-      attachInterrupt(pin, ISR_BackButtonPress, GPIO_INTR_NEGEDGE);
+      attachInterrupt(pin, ISR_BackButtonPress, GPIO_INTR_ANYEDGE);
       break;
     case up_btn:
-      attachInterrupt(pin, ISR_UpButtonPress, GPIO_INTR_NEGEDGE);
+      attachInterrupt(pin, ISR_UpButtonPress, GPIO_INTR_ANYEDGE);
       break;
     case down_btn:
-      attachInterrupt(pin, ISR_DownButtonPress, GPIO_INTR_NEGEDGE);
+      attachInterrupt(pin, ISR_DownButtonPress, GPIO_INTR_ANYEDGE);
       break;
     default:
       break;
   }
 }
+
+void pollButtons() {
+  for (uint8_t index = 0; index < 4; index++) {
+    Button &b = buttons[index];
+    if (!digitalRead(b.pin)) {
+      continue;
+    }
+    portENTER_CRITICAL(&buttonsMux);
+    if (b.down) {
+      portEXIT_CRITICAL(&buttonsMux);
+      continue;
+    }
+    b.down = true;
+    b.lastEdge = micros();
+    const int bounces = b.bounces;
+    b.bounces = 0;
+    b.repeats = 0;
+    portEXIT_CRITICAL(&buttonsMux);
+    xTimerChangePeriod(b.timer, pdMS_TO_TICKS(BUTTON_LONG_PRESS_US / 1000), 0);
+    Watchy_Event::Event{
+        .id = Watchy_Event::ID(Watchy_Event::MENU_BTN_DOWN + index),
+        .micros = b.lastEdge,
+        {.bounces = bounces},
+    }.send();
+  }
+}
+
+bool anyButtonDown() {
+  for (const Button &b : buttons) {
+    if (b.down) {
+      return true;
+    }
+  }
+  return false;
+}
 }  // namespace WatchyInterrupts
\ No newline at end of file
@@ -10,6 +10,11 @@ typedef enum { menu_btn = 0, back_btn, up_btn, down_btn } ButtonIndex;
  * buttonGetPressMask */
 void buttonSetup(int pin, ButtonIndex index);
 void timerSetup();
+// whether any button is being held down
+bool anyButtonDown();
+// presses the interrupts missed, because they were switched off (for a light
+// sleep), are sent as if the interrupts had seen them
+void pollButtons();
 int8_t buttonGet();
 inline bool buttonWasPressed(const uint8_t pressMask, const ButtonIndex index) {
   return (pressMask & (1 << index)) != 0;
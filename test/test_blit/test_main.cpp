@@ -0,0 +1,73 @@
+// WatchyDisplay's bitmap blit against Adafruit_GFX's pixel by pixel
+// drawBitmap, over random bitmaps at random positions, partly or wholly off
+// screen, byte aligned or not, transparent and opaque, in every color. Both
+// draw over the same random frame buffer, and have to leave it the same.
+// Runs on the host, with the [env:native] stand-ins:
+//
+//   pio test -e native
+
+#include <stdlib.h>
+#include <string.h>
+#include <unity.h>
+
+#include "Watchy.h"
+
+const uint16_t BUFFER_BYTES =
+    WatchyDisplay::WIDTH_BYTES * GxEPD2_154_D67::HEIGHT;
+const uint16_t CASES = 20000;
+
+uint8_t before[BUFFER_BYTES];
+uint8_t expected[BUFFER_BYTES];
+uint8_t bitmap[(120 / 8) * 60];
+
+void setUp() {}
+void tearDown() {}
+
+void test_blit_matches_gfx() {
+  WatchyDisplay &display = Watchy::display;
+  srand(3);
+  for (uint16_t n = 0; n < CASES; n++) {
+    const int16_t w = 1 + rand() % 120, h = 1 + rand() % 60;
+    int16_t x = rand() % 260 - 60;
+    const int16_t y = rand() % 260 - 60;
+    if (n % 3 == 0) {
+      x &= ~7;  // byte aligned, which opaque bitmaps copy straight in
+    }
+    const uint16_t color = rand() & 1, bg = rand() & 1;
+    const bool opaque = rand() & 1;
+    for (uint16_t i = 0; i < sizeof(bitmap); i++) {
+      bitmap[i] = rand();
+    }
+    for (uint16_t i = 0; i < BUFFER_BYTES; i++) {
+      before[i] = rand();
+    }
+
+    memcpy(display.getBuffer(), before, BUFFER_BYTES);
+    if (opaque) {
+      display.Adafruit_GFX::drawBitmap(x, y, bitmap, w, h, color, bg);
+    } else {
+      display.Adafruit_GFX::drawBitmap(x, y, bitmap, w, h, color);
+    }
+    memcpy(expected, display.getBuffer(), BUFFER_BYTES);
+
+    memcpy(display.getBuffer(), before, BUFFER_BYTES);
+    if (opaque) {
+      display.drawBitmap(x, y, (const uint8_t *)bitmap, w, h, color, bg);
+    } else {
+      display.drawBitmap(x, y, (const uint8_t *)bitmap, w, h, color);
+    }
+
+    char message[80];
+    snprintf(message, sizeof(message),
+             "case %u: %dx%d at %d,%d color %u bg %u %s", n, w, h, x, y,
+             color, bg, opaque ? "opaque" : "transparent");
+    TEST_ASSERT_EQUAL_MEMORY_MESSAGE(expected, display.getBuffer(),
+                                     BUFFER_BYTES, message);
+  }
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_blit_matches_gfx);
+  return UNITY_END();
+}
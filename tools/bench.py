@@ -0,0 +1,96 @@
+#!/usr/bin/env python3
+"""Summarize the serial output of the rendering benchmarks (see src/Bench.h).
+
+  pio run -e bench -t upload && pio device monitor | tee new.log
+  tools/bench.py new.log
+  tools/bench.py --baseline old.log --frames frames new.log
+
+or, without a watch, on the host (see [env:native] in platformio.ini)
+
+  pio run -e native && .pio/build/native/program > new.log
+
+Prints how long each screen took to draw and how much drawing it did. With
+--baseline the times are compared with an earlier run, and any screen whose
+frame differs is reported, so an optimization that changes what is drawn
+fails loudly. With --frames every frame is written out as a PBM image.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+WIDTH = 200
+HEIGHT = 200
+
+BENCH = re.compile(r'bench (\S+) (\d+) us (\d+) pixels (\d+) spans (\d+) glyphs')
+FRAME = re.compile(r'frame (\S+) ([0-9a-f]{%d})\s*$' % (WIDTH // 4))
+
+
+def read_log(path):
+    """returns {name: (us, pixels, spans, glyphs)} and {name: [hex rows]}"""
+    results = {}
+    frames = {}
+    for line in open(path, errors='replace'):
+        m = BENCH.search(line)
+        if m:
+            results[m.group(1)] = tuple(int(v) for v in m.groups()[1:])
+            continue
+        m = FRAME.search(line)
+        if m:
+            frames.setdefault(m.group(1), []).append(m.group(2))
+    for name, rows in frames.items():
+        if len(rows) != HEIGHT:
+            raise ValueError('%s: frame %s has %d rows' % (path, name, len(rows)))
+    return results, frames
+
+
+def write_pbm(path, rows):
+    # the frame buffer has 1 for white, PBM has 1 for black
+    with open(path, 'wb') as f:
+        f.write(b'P4\n%d %d\n' % (WIDTH, HEIGHT))
+        for row in rows:
+            f.write(bytes(b ^ 0xFF for b in bytes.fromhex(row)))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('log', help='serial output of the bench build')
+    parser.add_argument('--baseline', metavar='LOG',
+                        help='serial output of an earlier run to compare with')
+    parser.add_argument('--frames', metavar='DIR',
+                        help='write each frame to DIR/<screen>.pbm')
+    args = parser.parse_args()
+    results, frames = read_log(args.log)
+    if not results:
+        sys.exit('%s: no benchmark results' % args.log)
+    base_results, base_frames = {}, {}
+    if args.baseline:
+        base_results, base_frames = read_log(args.baseline)
+
+    changed = []
+    print('%-16s %9s %9s %7s %7s%s' % ('screen', 'us', 'pixels', 'spans', 'glyphs',
+                                      '  vs baseline' if args.baseline else ''))
+    for name, (us, pixels, spans, glyphs) in results.items():
+        compare = ''
+        if name in base_results:
+            old = base_results[name][0]
+            compare = ' %+8d us %+6.1f%%' % (us - old, 100.0 * (us - old) / max(old, 1))
+            if frames.get(name) != base_frames.get(name):
+                changed.append(name)
+                compare += '  frame changed'
+        elif args.baseline:
+            compare = ' new'
+        print('%-16s %9d %9d %7d %7d%s' % (name, us, pixels, spans, glyphs, compare))
+
+    if args.frames:
+        os.makedirs(args.frames, exist_ok=True)
+        for name, rows in frames.items():
+            write_pbm(os.path.join(args.frames, name + '.pbm'), rows)
+    if changed:
+        sys.exit('frames changed: %s' % ' '.join(changed))
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,208 @@
+#include <Adafruit_GFX.h>
+
+#include "OptimaLTStd22pt7b.h"
+
+const uint8_t OptimaLTStd22pt7bBitmaps[] PROGMEM = {
+  0x00, 0x00, 0x7C, 0x00, 0x00, 0x71, 0xC0, 0x00, 0x38, 0x38, 0x00, 0x0C,
+  0x06, 0x00, 0x07, 0x01, 0x80, 0x01, 0xC0, 0x60, 0x00, 0x70, 0x18, 0x00,
+  0x1C, 0x0E, 0x00, 0x07, 0x83, 0x00, 0x00, 0xE1, 0x80, 0x00, 0x3C, 0xC0,
+  0x00, 0x07, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x37,
+  0x80, 0x18, 0x39, 0xF0, 0x06, 0x1C, 0x3E, 0x03, 0x8E, 0x07, 0xC0, 0xC7,
+  0x00, 0xF0, 0x61, 0xC0, 0x3E, 0x18, 0xF0, 0x07, 0xCC, 0x3C, 0x00, 0xFE,
+  0x0F, 0x00, 0x1F, 0x03, 0xC0, 0x03, 0xE0, 0xF0, 0x00, 0xF8, 0x1E, 0x00,
+  0x3F, 0x07, 0xC0, 0x1B, 0xE0, 0xF8, 0x1C, 0x7C, 0x1F, 0xFC, 0x0F, 0x81,
+  0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x0E, 0x1C, 0x78, 0xE1, 0xC7, 0x0E,
+  0x18, 0x60, 0xC1, 0x06, 0x00, 0x6F, 0xFF, 0x60, 0x00, 0x1C, 0x00, 0x60,
+  0x01, 0x80, 0x0E, 0x00, 0x30, 0x00, 0xC0, 0x06, 0x00, 0x18, 0x00, 0xE0,
+  0x03, 0x00, 0x0C, 0x00, 0x70, 0x01, 0x80, 0x06, 0x00, 0x30, 0x00, 0xC0,
+  0x07, 0x00, 0x18, 0x00, 0x60, 0x03, 0x80, 0x0C, 0x00, 0x30, 0x01, 0x80,
+  0x06, 0x00, 0x38, 0x00, 0xC0, 0x03, 0x00, 0x18, 0x00, 0x60, 0x03, 0x80,
+  0x0C, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x79, 0xF0, 0x0E, 0x07, 0x81, 0xC0,
+  0x38, 0x38, 0x01, 0xC3, 0x80, 0x1E, 0x70, 0x01, 0xE7, 0x00, 0x0E, 0x70,
+  0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xE0, 0x00, 0xFE,
+  0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F, 0xE0, 0x00, 0xFE, 0x00, 0x0F,
+  0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xEF, 0x00, 0x0E, 0x70, 0x00,
+  0xE7, 0x00, 0x1E, 0x78, 0x01, 0xC3, 0x80, 0x1C, 0x3C, 0x03, 0x81, 0xE0,
+  0x70, 0x0F, 0x9E, 0x00, 0x1F, 0x80, 0x00, 0xC0, 0xF0, 0xFC, 0xFF, 0xF3,
+  0xD0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0,
+  0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F,
+  0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0x03, 0xF8, 0x03, 0xFF, 0x81,
+  0xC0, 0xF0, 0xE0, 0x1E, 0x30, 0x07, 0x84, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x38, 0x00, 0x1E, 0x00, 0x07,
+  0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00,
+  0x07, 0x00, 0x03, 0x80, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18,
+  0x00, 0x0C, 0x00, 0x06, 0x00, 0x03, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0x07, 0xE0, 0x0F, 0x7C, 0x0C, 0x0F, 0x04, 0x03, 0xC2, 0x00, 0xF0,
+  0x00, 0x78, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x07, 0x00, 0x03,
+  0x80, 0x03, 0x80, 0x03, 0x80, 0x27, 0x00, 0x1F, 0xC0, 0x00, 0x7C, 0x00,
+  0x0F, 0x00, 0x07, 0x80, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x3C,
+  0x00, 0x1E, 0x00, 0x0F, 0x00, 0x07, 0x80, 0x07, 0xA0, 0x03, 0x9C, 0x07,
+  0x8F, 0x8F, 0x81, 0xFE, 0x00, 0x00, 0x03, 0x80, 0x00, 0x3C, 0x00, 0x03,
+  0xE0, 0x00, 0x1F, 0x00, 0x01, 0xF8, 0x00, 0x1B, 0xC0, 0x00, 0xDE, 0x00,
+  0x0C, 0xF0, 0x00, 0xC7, 0x80, 0x04, 0x3C, 0x00, 0x61, 0xE0, 0x06, 0x0F,
+  0x00, 0x60, 0x78, 0x03, 0x03, 0xC0, 0x30, 0x1E, 0x03, 0x00, 0xF0, 0x18,
+  0x07, 0x81, 0x80, 0x3C, 0x18, 0x01, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x80, 0x03, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x00,
+  0x3C, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x1F, 0xFF,
+  0x87, 0xFF, 0xE1, 0xFF, 0xF8, 0x60, 0x00, 0x18, 0x00, 0x06, 0x00, 0x01,
+  0x80, 0x00, 0x60, 0x00, 0x18, 0x00, 0x06, 0x00, 0x01, 0x80, 0x00, 0x60,
+  0x00, 0x1B, 0xF8, 0x07, 0xFF, 0x81, 0x81, 0xF0, 0x00, 0x3C, 0x00, 0x07,
+  0x80, 0x01, 0xE0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0E, 0x00, 0x07, 0x80, 0x01, 0xC4, 0x00, 0xF3, 0x80,
+  0x70, 0x7C, 0xF8, 0x07, 0xF8, 0x00, 0x00, 0x7E, 0x00, 0x3E, 0xC0, 0x1E,
+  0x00, 0x07, 0x80, 0x01, 0xE0, 0x00, 0x38, 0x00, 0x0F, 0x00, 0x01, 0xC0,
+  0x00, 0x78, 0x00, 0x0E, 0x00, 0x01, 0xC0, 0x00, 0x78, 0x00, 0x0F, 0x1F,
+  0x81, 0xC7, 0xFC, 0x39, 0x83, 0xE7, 0x40, 0x3E, 0xF8, 0x03, 0xDE, 0x00,
+  0x7B, 0xC0, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xE0, 0x03, 0xFC, 0x00,
+  0x7B, 0x80, 0x0E, 0x70, 0x03, 0xCF, 0x00, 0x70, 0xE0, 0x1E, 0x0E, 0x07,
+  0x80, 0xF3, 0xE0, 0x07, 0xF0, 0x00, 0xF8, 0x00, 0x0F, 0xFF, 0xFD, 0xFF,
+  0xFF, 0x3F, 0xFF, 0xE0, 0x00, 0x18, 0x00, 0x03, 0x00, 0x00, 0xC0, 0x00,
+  0x30, 0x00, 0x06, 0x00, 0x01, 0x80, 0x00, 0x30, 0x00, 0x0C, 0x00, 0x03,
+  0x00, 0x00, 0x60, 0x00, 0x18, 0x00, 0x03, 0x00, 0x00, 0xC0, 0x00, 0x38,
+  0x00, 0x06, 0x00, 0x01, 0xC0, 0x00, 0x70, 0x00, 0x0C, 0x00, 0x03, 0x80,
+  0x00, 0x60, 0x00, 0x1C, 0x00, 0x07, 0x00, 0x00, 0xE0, 0x00, 0x38, 0x00,
+  0x07, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x7D, 0xF0, 0x0E, 0x07, 0x81, 0xC0,
+  0x38, 0x3C, 0x03, 0xC3, 0xC0, 0x3C, 0x38, 0x01, 0xC3, 0x80, 0x1C, 0x3C,
+  0x01, 0xC3, 0xC0, 0x38, 0x1C, 0x03, 0x80, 0xE0, 0x70, 0x07, 0x9C, 0x00,
+  0x3F, 0xE0, 0x0F, 0x0F, 0x81, 0xC0, 0x3C, 0x38, 0x03, 0xC7, 0x80, 0x1E,
+  0x78, 0x01, 0xE7, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00,
+  0xE7, 0x00, 0x0E, 0x78, 0x01, 0xE7, 0x80, 0x1C, 0x3C, 0x03, 0xC1, 0xE0,
+  0x78, 0x0F, 0x9E, 0x00, 0x3F, 0x80, 0x03, 0xF8, 0x01, 0xF7, 0xC0, 0x78,
+  0x1C, 0x1E, 0x01, 0xC7, 0x80, 0x1C, 0xE0, 0x03, 0xBC, 0x00, 0x77, 0x80,
+  0x0F, 0xF0, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0xFF, 0x00,
+  0x3E, 0xF0, 0x07, 0xDE, 0x01, 0xB9, 0xE0, 0x6F, 0x1F, 0xF9, 0xE0, 0xFE,
+  0x3C, 0x00, 0x07, 0x80, 0x00, 0xE0, 0x00, 0x1C, 0x00, 0x07, 0x80, 0x00,
+  0xE0, 0x00, 0x1C, 0x00, 0x07, 0x00, 0x01, 0xE0, 0x00, 0x38, 0x10, 0x1E,
+  0x01, 0xCF, 0x00, 0x1F, 0x80, 0x00, 0x6F, 0xFF, 0x60, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x6F, 0xFF, 0x60, 0x07, 0xF0, 0x07, 0xFE, 0x03, 0x83, 0xC0,
+  0x80, 0x78, 0x40, 0x0E, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x07, 0xC0, 0x1F, 0xF0, 0x7C, 0x3C, 0x78, 0x0E, 0x1C, 0x03,
+  0x8F, 0x00, 0xE3, 0x80, 0x38, 0xE0, 0x0E, 0x3C, 0x03, 0x8F, 0x01, 0xF1,
+  0xE0, 0xDE, 0x7F, 0xC7, 0xC7, 0xE0, 0x00, 0xF0, 0x00, 0x07, 0x00, 0x00,
+  0x70, 0x00, 0x07, 0x00, 0x00, 0x70, 0x00, 0x07, 0x00, 0x00, 0x70, 0x00,
+  0x07, 0x00, 0x00, 0x70, 0x00, 0x07, 0x00, 0x00, 0x70, 0x00, 0x07, 0x07,
+  0xC0, 0x71, 0xFF, 0x07, 0x30, 0x78, 0x74, 0x03, 0xC7, 0x80, 0x1E, 0x78,
+  0x01, 0xE7, 0x80, 0x0F, 0x70, 0x00, 0xF7, 0x00, 0x0F, 0x70, 0x00, 0xF7,
+  0x00, 0x0F, 0x70, 0x00, 0xF7, 0x00, 0x0F, 0x70, 0x00, 0xF7, 0x00, 0x0F,
+  0x70, 0x00, 0xE7, 0x80, 0x1E, 0x78, 0x01, 0xC7, 0xC0, 0x3C, 0x66, 0x07,
+  0x8C, 0x39, 0xE0, 0x00, 0xF8, 0x00, 0x01, 0xFE, 0x01, 0xF3, 0xE1, 0xE0,
+  0x38, 0xF0, 0x06, 0x38, 0x00, 0x9E, 0x00, 0x07, 0x00, 0x03, 0xC0, 0x00,
+  0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x13, 0xC0,
+  0x0C, 0x7C, 0x0E, 0x07, 0xFF, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xE0, 0x00,
+  0x1C, 0x00, 0x03, 0x80, 0x00, 0x70, 0x00, 0x0E, 0x00, 0x01, 0xC0, 0x00,
+  0x38, 0x00, 0x07, 0x00, 0x00, 0xE0, 0x00, 0x1C, 0x00, 0x03, 0x81, 0xF8,
+  0x70, 0xFF, 0xCE, 0x3C, 0x0D, 0xCF, 0x00, 0xBB, 0xC0, 0x0F, 0x78, 0x01,
+  0xFE, 0x00, 0x3F, 0xC0, 0x03, 0xF8, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x01,
+  0xFC, 0x00, 0x3F, 0x80, 0x07, 0xF0, 0x00, 0xFE, 0x00, 0x3F, 0xC0, 0x07,
+  0xB8, 0x00, 0xF7, 0x80, 0x3E, 0x70, 0x05, 0xC7, 0x83, 0x38, 0x7F, 0xC7,
+  0x03, 0xE0, 0x00, 0x01, 0xFC, 0x00, 0xFB, 0xE0, 0x38, 0x0E, 0x0E, 0x01,
+  0xE3, 0xC0, 0x1C, 0x70, 0x03, 0xDE, 0x00, 0x3B, 0xC0, 0x07, 0x70, 0x00,
+  0xEF, 0xFF, 0xFD, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0x00, 0x00, 0xE0, 0x00,
+  0x1E, 0x00, 0x03, 0xC0, 0x00, 0x38, 0x00, 0x07, 0x80, 0x00, 0x78, 0x01,
+  0x07, 0x80, 0xE0, 0x7F, 0xF0, 0x01, 0xF8, 0x00, 0x00, 0x70, 0x1F, 0x03,
+  0xF0, 0x61, 0x04, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x1C, 0x01, 0xC0, 0x1C,
+  0x01, 0xC0, 0x1C, 0x0F, 0xFC, 0xFF, 0xC1, 0xC0, 0x1C, 0x01, 0xC0, 0x1C,
+  0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x1C,
+  0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x3C, 0x00, 0x03, 0xFF,
+  0xE0, 0xF1, 0xE2, 0x1C, 0x07, 0x03, 0x80, 0x78, 0x38, 0x03, 0x87, 0x80,
+  0x38, 0x78, 0x03, 0x87, 0x80, 0x38, 0x78, 0x03, 0x87, 0x80, 0x38, 0x38,
+  0x07, 0x81, 0xC0, 0x70, 0x0E, 0x1E, 0x00, 0x7F, 0x80, 0x0C, 0x00, 0x01,
+  0x80, 0x00, 0x38, 0x00, 0x03, 0x80, 0x00, 0x3F, 0xF8, 0x01, 0xFF, 0xF8,
+  0x0F, 0xFF, 0xC1, 0xC0, 0x3E, 0x38, 0x01, 0xE7, 0x00, 0x0F, 0x60, 0x00,
+  0xFE, 0x00, 0x0E, 0xE0, 0x00, 0xEE, 0x00, 0x0E, 0x70, 0x00, 0xC7, 0x00,
+  0x1C, 0x38, 0x03, 0x81, 0xE1, 0xE0, 0x03, 0xF8, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x1C, 0x00, 0x07, 0x00,
+  0x01, 0xC0, 0x00, 0x70, 0x00, 0x1C, 0x00, 0x07, 0x00, 0x01, 0xC3, 0xF0,
+  0x73, 0xFE, 0x1D, 0xC7, 0xC7, 0xC0, 0x79, 0xE0, 0x1E, 0x70, 0x03, 0xDC,
+  0x00, 0xF7, 0x00, 0x3D, 0xC0, 0x0F, 0x70, 0x03, 0xDC, 0x00, 0xF7, 0x00,
+  0x3D, 0xC0, 0x0F, 0x70, 0x03, 0xDC, 0x00, 0xF7, 0x00, 0x3F, 0xC0, 0x0F,
+  0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0x6F, 0xFF, 0x00,
+  0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x06, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0E, 0x0E, 0x1E, 0x1C, 0x78, 0xE0, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00,
+  0x03, 0xC0, 0x00, 0xF0, 0x00, 0x1C, 0x00, 0x07, 0x00, 0x01, 0xC0, 0x00,
+  0x70, 0x00, 0x1C, 0x00, 0x07, 0x00, 0x01, 0xC0, 0x00, 0x70, 0x07, 0x9C,
+  0x01, 0xC7, 0x00, 0xE1, 0xC0, 0x60, 0x70, 0x30, 0x1C, 0x18, 0x07, 0x0C,
+  0x01, 0xC6, 0x00, 0x77, 0x00, 0x1F, 0xE0, 0x07, 0x78, 0x01, 0xCF, 0x00,
+  0x71, 0xE0, 0x1C, 0x3C, 0x07, 0x07, 0x83, 0xC0, 0xF0, 0xF0, 0x1E, 0x3C,
+  0x07, 0xCF, 0x00, 0xFB, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xF8,
+  0x0F, 0xC3, 0xCF, 0xF0, 0x7F, 0xCF, 0x73, 0xE3, 0x1F, 0xBE, 0x03, 0xD0,
+  0x1E, 0xF8, 0x07, 0x80, 0x3F, 0xC0, 0x1E, 0x00, 0xFF, 0x00, 0x78, 0x03,
+  0xFC, 0x01, 0xE0, 0x0F, 0xF0, 0x07, 0x80, 0x3F, 0xC0, 0x1E, 0x00, 0xFF,
+  0x00, 0x78, 0x03, 0xFC, 0x01, 0xE0, 0x0F, 0xF0, 0x07, 0x80, 0x3F, 0xC0,
+  0x1E, 0x00, 0xFF, 0x00, 0x78, 0x03, 0xFC, 0x01, 0xE0, 0x0F, 0xF0, 0x07,
+  0x80, 0x3F, 0xC0, 0x1E, 0x00, 0xFF, 0x00, 0x78, 0x03, 0xFC, 0x01, 0xE0,
+  0x0F, 0xF0, 0x07, 0x80, 0x3C, 0x00, 0xFC, 0x3C, 0xFF, 0x8F, 0x71, 0xF3,
+  0xF0, 0x1E, 0xF8, 0x07, 0x9C, 0x00, 0xF7, 0x00, 0x3D, 0xC0, 0x0F, 0x70,
+  0x03, 0xDC, 0x00, 0xF7, 0x00, 0x3D, 0xC0, 0x0F, 0x70, 0x03, 0xDC, 0x00,
+  0xF7, 0x00, 0x3D, 0xC0, 0x0F, 0x70, 0x03, 0xDC, 0x00, 0xFF, 0x00, 0x3F,
+  0xC0, 0x0F, 0xF0, 0x03, 0xC0, 0x00, 0xFC, 0x00, 0x3E, 0x7C, 0x03, 0x80,
+  0x70, 0x38, 0x01, 0xC3, 0xC0, 0x0F, 0x1C, 0x00, 0x39, 0xE0, 0x01, 0xEF,
+  0x00, 0x0F, 0x70, 0x00, 0x7B, 0x80, 0x01, 0xFC, 0x00, 0x0F, 0xE0, 0x00,
+  0x77, 0x00, 0x03, 0xB8, 0x00, 0x3D, 0xE0, 0x01, 0xEF, 0x00, 0x0F, 0x38,
+  0x00, 0x71, 0xE0, 0x07, 0x87, 0x00, 0x38, 0x1C, 0x03, 0x80, 0x7C, 0xF8,
+  0x00, 0x7F, 0x00, 0x00, 0xFC, 0x0F, 0x1F, 0xF0, 0x77, 0x07, 0x87, 0x40,
+  0x3C, 0x78, 0x01, 0xE7, 0x80, 0x1E, 0x78, 0x00, 0xF7, 0x00, 0x0F, 0x70,
+  0x00, 0xF7, 0x00, 0x0F, 0x70, 0x00, 0xF7, 0x00, 0x0F, 0x70, 0x00, 0xF7,
+  0x00, 0x0F, 0x70, 0x00, 0xF7, 0x00, 0x0E, 0x78, 0x01, 0xE7, 0x80, 0x1E,
+  0x7C, 0x03, 0xC7, 0x60, 0x78, 0x73, 0xFF, 0x07, 0x0F, 0xC0, 0x70, 0x00,
+  0x07, 0x00, 0x00, 0x70, 0x00, 0x07, 0x00, 0x00, 0x70, 0x00, 0x07, 0x00,
+  0x00, 0x70, 0x00, 0x07, 0x00, 0x00, 0x70, 0x00, 0x07, 0x00, 0x00, 0xF0,
+  0x00, 0x00, 0x03, 0xF0, 0x01, 0xFF, 0x9C, 0x78, 0x3B, 0x9E, 0x01, 0x77,
+  0x80, 0x1E, 0xF0, 0x03, 0xFC, 0x00, 0x7F, 0x80, 0x07, 0xF0, 0x00, 0xFE,
+  0x00, 0x1F, 0xC0, 0x03, 0xF8, 0x00, 0x7F, 0x00, 0x0F, 0xE0, 0x01, 0xFC,
+  0x00, 0x7F, 0x80, 0x0F, 0x70, 0x01, 0xEF, 0x00, 0x7C, 0xE0, 0x1B, 0x8F,
+  0x06, 0x70, 0xFF, 0x8E, 0x07, 0xC1, 0xC0, 0x00, 0x38, 0x00, 0x07, 0x00,
+  0x00, 0xE0, 0x00, 0x1C, 0x00, 0x03, 0x80, 0x00, 0x70, 0x00, 0x0E, 0x00,
+  0x01, 0xC0, 0x00, 0x38, 0x00, 0x07, 0x00, 0x00, 0xE0, 0x01, 0xFE, 0x7B,
+  0xDF, 0x7F, 0x2F, 0x81, 0xF0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0,
+  0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x78,
+  0x0F, 0x00, 0x0F, 0xC1, 0xFF, 0x9C, 0x18, 0xC0, 0x4E, 0x00, 0x70, 0x03,
+  0x80, 0x1E, 0x00, 0xF8, 0x03, 0xF8, 0x1F, 0xF0, 0x3F, 0xE0, 0x3F, 0x80,
+  0x7C, 0x01, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xF0, 0x0D, 0xC0, 0xCF, 0xFC,
+  0x1F, 0x80, 0x04, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x38, 0x3F, 0xF7,
+  0xFE, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x01, 0xE0,
+  0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x00, 0xE0, 0x1E,
+  0x01, 0xE4, 0x1F, 0x00, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0,
+  0x0E, 0xF0, 0x03, 0xBC, 0x00, 0xEF, 0x00, 0x3B, 0x80, 0x0E, 0xE0, 0x03,
+  0xB8, 0x00, 0xEE, 0x00, 0x3B, 0x80, 0x0E, 0xE0, 0x03, 0xBC, 0x00, 0xEF,
+  0x00, 0x3B, 0xC0, 0x1E, 0x70, 0x07, 0x9E, 0x03, 0xE3, 0xE3, 0xB8, 0x7F,
+  0xCF, 0x0F, 0xC0, 0x00, 0xF0, 0x00, 0x67, 0x00, 0x0E, 0x78, 0x00, 0xC7,
+  0x80, 0x0C, 0x3C, 0x01, 0xC3, 0xC0, 0x18, 0x1C, 0x03, 0x81, 0xE0, 0x30,
+  0x0E, 0x03, 0x00, 0xE0, 0x60, 0x0F, 0x06, 0x00, 0x70, 0x40, 0x07, 0x8C,
+  0x00, 0x38, 0xC0, 0x03, 0xD8, 0x00, 0x3D, 0x80, 0x01, 0xF0, 0x00, 0x1F,
+  0x00, 0x00, 0xF0, 0x00, 0x0E, 0x00, 0xF0, 0x01, 0xC0, 0x07, 0xF0, 0x03,
+  0xC0, 0x0E, 0x70, 0x03, 0xC0, 0x0E, 0x78, 0x03, 0xC0, 0x0C, 0x38, 0x07,
+  0xE0, 0x1C, 0x38, 0x06, 0xE0, 0x18, 0x3C, 0x06, 0xF0, 0x18, 0x1C, 0x0C,
+  0x70, 0x30, 0x1C, 0x0C, 0x70, 0x30, 0x0E, 0x08, 0x78, 0x60, 0x0E, 0x18,
+  0x38, 0x60, 0x0F, 0x18, 0x38, 0x60, 0x07, 0x10, 0x3C, 0xC0, 0x07, 0x30,
+  0x1C, 0xC0, 0x07, 0xB0, 0x1D, 0x80, 0x03, 0xE0, 0x1F, 0x80, 0x03, 0xE0,
+  0x0F, 0x00, 0x03, 0xE0, 0x0F, 0x00, 0x01, 0xC0, 0x0F, 0x00, 0x01, 0xC0,
+  0x06, 0x00, 0xF8, 0x00, 0xEF, 0x80, 0x38, 0xF0, 0x0E, 0x0F, 0x03, 0x80,
+  0xF0, 0x60, 0x1E, 0x18, 0x01, 0xE6, 0x00, 0x1F, 0x80, 0x01, 0xF0, 0x00,
+  0x3C, 0x00, 0x03, 0xC0, 0x00, 0xFC, 0x00, 0x33, 0xC0, 0x0E, 0x38, 0x01,
+  0x87, 0x80, 0x60, 0x78, 0x18, 0x07, 0x87, 0x00, 0xF1, 0xC0, 0x0F, 0x70,
+  0x00, 0xF0, 0xF0, 0x00, 0x67, 0x00, 0x0E, 0x78, 0x00, 0xC7, 0x80, 0x0C,
+  0x38, 0x01, 0x83, 0xC0, 0x18, 0x1C, 0x03, 0x81, 0xE0, 0x30, 0x0E, 0x03,
+  0x00, 0xE0, 0x60, 0x0F, 0x06, 0x00, 0x70, 0x40, 0x07, 0x8C, 0x00, 0x38,
+  0x80, 0x03, 0x98, 0x00, 0x3D, 0x80, 0x01, 0xF0, 0x00, 0x1F, 0x00, 0x00,
+  0xE0, 0x00, 0x0E, 0x00, 0x00, 0xC0, 0x00, 0x0C, 0x00, 0x00, 0x80, 0x00,
+  0x18, 0x00, 0x01, 0x80, 0x00, 0x30, 0x00, 0x03, 0x00, 0x00, 0x60, 0x00,
+  0x06, 0x00, 0x00, 0xE0, 0x00, 0x0C, 0x00, 0x01, 0xC0, 0x00, 0x1F, 0xFF,
+  0xE3, 0xFF, 0xF8, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C,
+  0x00, 0x07, 0x00, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x03, 0x80,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0x70, 0x00,
+  0x1E, 0x00, 0x07, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0 };
+
+const GFXfont OptimaLTStd22pt7bStruct PROGMEM = {
+  (uint8_t  *)OptimaLTStd22pt7bBitmaps,
+  (GFXglyph *)OptimaLTStd22pt7bGlyphs,
+  0x20, 0x7A, 52 };
+
+const GFXfont *OptimaLTStd22pt7b PROGMEM = &OptimaLTStd22pt7bStruct;
+
+// Approx. 2970 bytes
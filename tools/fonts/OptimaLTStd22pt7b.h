@@ -0,0 +1,99 @@
+#pragma once
+
+#include <Adafruit_GFX.h>
+extern const GFXfont *OptimaLTStd22pt7b;
+
+// the glyphs are in the header so that text can be measured at compile time,
+// see textBounds() in GFXTextUtil.h
+constexpr GFXglyph OptimaLTStd22pt7bGlyphs[] = {
+  {     0,   1,   1,  12,    0,    0 },   // 0x20 ' '
+  {     0,   0,   0,   0,    0,    0 },   // 0x21 '!'
+  {     0,   0,   0,   0,    0,    0 },   // 0x22 '"'
+  {     0,   0,   0,   0,    0,    0 },   // 0x23 '#'
+  {     0,   0,   0,   0,    0,    0 },   // 0x24 '$'
+  {     0,   0,   0,   0,    0,    0 },   // 0x25 '%'
+  {     1,  26,  30,  31,    3,  -28 },   // 0x26 '&'
+  {    99,   2,  12,  12,    5,  -29 },   // 0x27 '''
+  {     0,   0,   0,   0,    0,    0 },   // 0x28 '('
+  {     0,   0,   0,   0,    0,    0 },   // 0x29 ')'
+  {     0,   0,   0,   0,    0,    0 },   // 0x2A '*'
+  {     0,   0,   0,   0,    0,    0 },   // 0x2B '+'
+  {   102,   7,  12,  12,    1,   -4 },   // 0x2C ','
+  {     0,   0,   0,   0,    0,    0 },   // 0x2D '-'
+  {   113,   4,   5,  12,    4,   -3 },   // 0x2E '.'
+  {   116,  14,  31,  12,   -1,  -29 },   // 0x2F '/'
+  {   171,  20,  30,  24,    2,  -28 },   // 0x30 '0'
+  {   246,  10,  29,  24,    4,  -28 },   // 0x31 '1'
+  {   283,  18,  29,  24,    1,  -28 },   // 0x32 '2'
+  {   349,  17,  30,  24,    2,  -28 },   // 0x33 '3'
+  {   413,  21,  29,  24,    1,  -28 },   // 0x34 '4'
+  {   490,  18,  30,  24,    2,  -28 },   // 0x35 '5'
+  {   558,  19,  30,  24,    3,  -28 },   // 0x36 '6'
+  {   630,  19,  29,  24,    3,  -28 },   // 0x37 '7'
+  {   699,  20,  30,  24,    2,  -28 },   // 0x38 '8'
+  {   774,  19,  30,  24,    2,  -28 },   // 0x39 '9'
+  {   846,   4,  21,  12,    4,  -19 },   // 0x3A ':'
+  {     0,   0,   0,   0,    0,    0 },   // 0x3B ';'
+  {     0,   0,   0,   0,    0,    0 },   // 0x3C '<'
+  {     0,   0,   0,   0,    0,    0 },   // 0x3D '='
+  {     0,   0,   0,   0,    0,    0 },   // 0x3E '>'
+  {     0,   0,   0,   0,    0,    0 },   // 0x3F '?'
+  {     0,   0,   0,   0,    0,    0 },   // 0x40 '@'
+  {   857,  18,  22,  22,    2,  -20 },   // 0x41 'A'
+  {   907,  20,  33,  24,    2,  -31 },   // 0x42 'B'
+  {   990,  18,  22,  22,    2,  -20 },   // 0x43 'C'
+  {  1040,  19,  33,  24,    2,  -31 },   // 0x44 'D'
+  {  1119,  19,  22,  22,    1,  -20 },   // 0x45 'E'
+  {  1172,  12,  33,  12,    1,  -32 },   // 0x46 'F'
+  {  1222,  20,  33,  22,    1,  -20 },   // 0x47 'G'
+  {  1305,  18,  32,  24,    3,  -31 },   // 0x48 'H'
+  {  1377,   4,  30,  12,    4,  -29 },   // 0x49 'I'
+  {  1392,   8,  42,  12,    0,  -29 },   // 0x4A 'J'
+  {  1434,  18,  32,  22,    3,  -31 },   // 0x4B 'K'
+  {  1506,   4,  32,  12,    4,  -31 },   // 0x4C 'L'
+  {  1522,  30,  21,  36,    3,  -20 },   // 0x4D 'M'
+  {  1601,  18,  21,  24,    3,  -20 },   // 0x4E 'N'
+  {  1649,  21,  22,  24,    1,  -20 },   // 0x4F 'O'
+  {  1707,  20,  33,  24,    2,  -20 },   // 0x50 'P'
+  {  1790,  19,  33,  24,    2,  -20 },   // 0x51 'Q'
+  {  1869,  11,  21,  14,    3,  -20 },   // 0x52 'R'
+  {  1898,  13,  22,  17,    2,  -20 },   // 0x53 'S'
+  {  1934,  11,  27,  12,    1,  -25 },   // 0x54 'T'
+  {  1972,  18,  21,  24,    3,  -19 },   // 0x55 'U'
+  {  2020,  20,  20,  22,    1,  -19 },   // 0x56 'V'
+  {  2070,  32,  20,  34,    1,  -19 },   // 0x57 'W'
+  {  2150,  19,  20,  22,    1,  -19 },   // 0x58 'X'
+  {  2198,  20,  32,  22,    1,  -19 },   // 0x59 'Y'
+  {  2278,  19,  20,  22,    1,  -19 },   // 0x5A 'Z'
+  {     0,   0,   0,   0,    0,    0 },   // 0x5B '['
+  {     0,   0,   0,   0,    0,    0 },   // 0x5C '\'
+  {     0,   0,   0,   0,    0,    0 },   // 0x5D ']'
+  {     0,   0,   0,   0,    0,    0 },   // 0x5E '^'
+  {     0,   0,   0,   0,    0,    0 },   // 0x5F '_'
+  {     0,   0,   0,   0,    0,    0 },   // 0x60 '`'
+  {   857,  18,  22,  22,    2,  -20 },   // 0x61 'a'
+  {   907,  20,  33,  24,    2,  -31 },   // 0x62 'b'
+  {   990,  18,  22,  22,    2,  -20 },   // 0x63 'c'
+  {  1040,  19,  33,  24,    2,  -31 },   // 0x64 'd'
+  {  1119,  19,  22,  22,    1,  -20 },   // 0x65 'e'
+  {  1172,  12,  33,  12,    1,  -32 },   // 0x66 'f'
+  {  1222,  20,  33,  22,    1,  -20 },   // 0x67 'g'
+  {  1305,  18,  32,  24,    3,  -31 },   // 0x68 'h'
+  {  1377,   4,  30,  12,    4,  -29 },   // 0x69 'i'
+  {  1392,   8,  42,  12,    0,  -29 },   // 0x6A 'j'
+  {  1434,  18,  32,  22,    3,  -31 },   // 0x6B 'k'
+  {  1506,   4,  32,  12,    4,  -31 },   // 0x6C 'l'
+  {  1522,  30,  21,  36,    3,  -20 },   // 0x6D 'm'
+  {  1601,  18,  21,  24,    3,  -20 },   // 0x6E 'n'
+  {  1649,  21,  22,  24,    1,  -20 },   // 0x6F 'o'
+  {  1707,  20,  33,  24,    2,  -20 },   // 0x70 'p'
+  {  1790,  19,  33,  24,    2,  -20 },   // 0x71 'q'
+  {  1869,  11,  21,  14,    3,  -20 },   // 0x72 'r'
+  {  1898,  13,  22,  17,    2,  -20 },   // 0x73 's'
+  {  1934,  11,  27,  12,    1,  -25 },   // 0x74 't'
+  {  1972,  18,  21,  24,    3,  -19 },   // 0x75 'u'
+  {  2020,  20,  20,  22,    1,  -19 },   // 0x76 'v'
+  {  2070,  32,  20,  34,    1,  -19 },   // 0x77 'w'
+  {  2150,  19,  20,  22,    1,  -19 },   // 0x78 'x'
+  {  2198,  20,  32,  22,    1,  -19 },   // 0x79 'y'
+  {  2278,  19,  20,  22,    1,  -19 } };  // 0x7A 'z'
@@ -0,0 +1,2 @@
+#include <Adafruit_GFX.h>
+extern const GFXfont *OptimaLTStd_Black32pt7b;
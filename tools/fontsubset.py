@@ -0,0 +1,176 @@
+#!/usr/bin/env python3
+"""Subset the GFXfonts in tools/fonts down to the characters that get drawn.
+
+The fonts in tools/fonts are the fontconvert output every glyph is taken from.
+Each one listed in FONTS below is written to src/Screens with every glyph
+that isn't in its character set emptied, its bitmap compacted, and its first
+and last characters trimmed to the ones that are left.
+
+  tools/fontsubset.py          # regenerate the fonts in src/Screens
+  tools/fontsubset.py --check  # fail if they are out of date (run by the build)
+
+A character set is the characters declared for a font, plus the characters of
+every string literal matching its scan patterns. tools/timewords.py renders
+its words from the fonts in tools/fonts, so they don't need to be kept here.
+
+Adafruit_GFX looks glyphs up by character - first, so the characters between
+first and last that aren't used still cost an empty GFXglyph each.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..')
+FONTS_DIR = os.path.join(ROOT, 'tools', 'fonts')
+SCREENS = os.path.join(ROOT, 'src', 'Screens')
+DIGITS = '0123456789'
+
+# font: (declared characters, [(file, regex whose group 1 is drawn text)])
+FONTS = {
+    # the hours and minutes in SetTimeScreen. The hour words TimeScreen
+    # shows are pre-rendered.
+    'OptimaLTStd_Black32pt7b': (DIGITS + ':', []),
+    # the step count in ShowStepsScreen, and the carousel labels. Faces.cpp
+    # measures the labels with textBounds(..., 0x20), so ' ' has to stay
+    # first. The minute words TimeScreen shows are pre-rendered.
+    'OptimaLTStd22pt7b': (' ' + DIGITS + 'steps', [
+        ('src/Screens/Faces.cpp', r'label22pt\("([^"]*)"\)'),
+    ]),
+}
+
+GLYPH = re.compile(r'\{\s*(\d+),\s*(\d+),\s*(\d+),\s*(\d+),\s*(-?\d+),\s*(-?\d+)\s*\}')
+EMPTY = (0, 0, 0, 0, 0, 0)
+
+
+def charset(name):
+    chars, scans = FONTS[name]
+    chars = set(chars)
+    for path, pattern in scans:
+        src = open(os.path.join(ROOT, path)).read()
+        for m in re.finditer(pattern, src):
+            chars |= set(m.group(1))
+    return chars
+
+
+def read_font(name):
+    """returns {ext: source text} for the .cpp and .h of a font"""
+    return {
+        ext: open(os.path.join(FONTS_DIR, name + ext)).read()
+        for ext in ('.cpp', '.h')
+    }
+
+
+BITMAPS = r'%sBitmaps\[\][^{]*\{(.*?)\};'
+# up to the end of the line closing the array, which has the last glyph's
+# comment on it
+GLYPHS = r'%sGlyphs\[\][^{]*\{(.*?\})\s*\}\s*;[^\n]*'
+# the last line, fontconvert leaves the original one commented out above it
+RANGE = (r'\(GFXglyph \*\)%sGlyphs,(?:\s*//[^\n]*)*\s*'
+         r'(0x[0-9A-Fa-f]+),\s*(0x[0-9A-Fa-f]+),')
+
+
+def find(files, pattern):
+    """(ext, match) for pattern in whichever file of the font has it"""
+    for ext, src in files.items():
+        m = re.search(pattern, src, re.S)
+        if m:
+            return ext, m
+    raise ValueError('%s not found' % pattern)
+
+
+def replace(files, pattern, text):
+    """replaces pattern, from the start of group 1 on, with text(match)"""
+    ext, m = find(files, pattern)
+    src = files[ext]
+    files[ext] = src[:m.start(1)] + text(m) + src[m.end(0):]
+
+
+def subset(name, chars):
+    """returns ({ext: subsetted source}, bytes before, bytes after)"""
+    files = read_font(name)
+    _, bitmap = find(files, BITMAPS % name)
+    _, glyphs = find(files, GLYPHS % name)
+    _, font = find(files, RANGE % name)
+    data = [int(v, 16) for v in re.findall(r'0x[0-9A-Fa-f]+', bitmap.group(1))]
+    table = [tuple(int(v) for v in g.groups())
+             for g in GLYPH.finditer(glyphs.group(1))]
+    first, last = int(font.group(1), 16), int(font.group(2), 16)
+    if len(table) != last - first + 1:
+        raise ValueError('%s: %d glyphs for 0x%02X..0x%02X' %
+                         (name, len(table), first, last))
+
+    kept = [c for c in range(first, last + 1)
+            if chr(c) in chars and table[c - first][1] > 0]
+    if not kept:
+        raise ValueError('%s: no glyphs left' % name)
+    missing = sorted(c for c in chars if ord(c) not in kept)
+    if missing:
+        sys.stderr.write('%s: no glyphs for %r\n' % (name, ''.join(missing)))
+    new_first, new_last = kept[0], kept[-1]
+    new_data = []
+    new_table = []
+    for c in range(new_first, new_last + 1):
+        g = table[c - first]
+        if c not in kept:
+            new_table.append(EMPTY)
+            continue
+        offset, w, h = g[0], g[1], g[2]
+        new_table.append((len(new_data),) + g[1:])
+        new_data += data[offset:offset + (w * h + 7) // 8]
+
+    rows = ['  ' + ', '.join('0x%02X' % b for b in new_data[i:i + 12])
+            for i in range(0, len(new_data), 12)]
+    lines = ['  {%6d,%4d,%4d,%4d,%5d,%5d %s // 0x%02X \'%s\'' %
+             (g + ('} };' if i == len(new_table) - 1 else '},  ',
+                   new_first + i, chr(new_first + i)))
+             for i, g in enumerate(new_table)]
+    out = dict(files)
+    replace(out, BITMAPS % name, lambda m: '\n' + ',\n'.join(rows) + ' };')
+    replace(out, GLYPHS % name, lambda m: '\n' + '\n'.join(lines))
+    replace(out, RANGE % name,
+            lambda m: '0x%02X, 0x%02X,' % (new_first, new_last))
+
+    # fontconvert's estimate, which leaves out padding
+    before = len(data) + (last - first + 1) * 7 + 7
+    after = len(new_data) + (new_last - new_first + 1) * 7 + 7
+    for ext in out:
+        out[ext] = re.sub(r'// Approx\. \d+ bytes', '// Approx. %d bytes' % after,
+                          out[ext])
+        out[ext] = ('// generated by tools/fontsubset.py from tools/fonts/%s%s, '
+                    'do not edit\n' % (name, ext)) + out[ext]
+    return out, before, after
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--check', action='store_true',
+                        help="don't write anything, fail if a font is out of date")
+    args = parser.parse_args()
+    stale = []
+    for name in FONTS:
+        chars = charset(name)
+        out, before, after = subset(name, chars)
+        for ext, src in out.items():
+            path = os.path.join(SCREENS, name + ext)
+            current = open(path).read() if os.path.exists(path) else None
+            if current == src:
+                continue
+            if args.check:
+                stale.append(path)
+            else:
+                open(path, 'w').write(src)
+        if not args.check:
+            sys.stderr.write('%s: %r, %d -> %d bytes\n' %
+                             (name, ''.join(sorted(chars)), before, after))
+    if stale:
+        sys.stderr.write('out of date, run tools/fontsubset.py: %s\n' %
+                         ' '.join(os.path.relpath(p, ROOT) for p in stale))
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
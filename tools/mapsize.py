@@ -0,0 +1,102 @@
+#!/usr/bin/env python3
+"""Report how much flash each object file (or symbol) takes, from the linker
+map the build writes to output.map (see build_flags in platformio.ini).
+
+  tools/mapsize.py output.map
+  tools/mapsize.py --filter Optima --symbols output.map
+  tools/mapsize.py --baseline before.map output.map
+
+Only input sections of output sections that are loaded from flash are
+counted: code and read only data, and the initial values of data in RAM.
+With --baseline every size is compared with an earlier map, so the saving
+from a change (like tools/fontsubset.py) can be read off directly.
+"""
+
+import argparse
+import collections
+import os
+import re
+import sys
+
+# output sections that aren't stored in the image
+NOT_FLASH = re.compile(r'bss|noinit|^\.debug|^\.comment|^\.xt|^\.stab')
+OUTPUT = re.compile(r'^(\.\S+)(?:\s+0x([0-9a-fA-F]+)\s+0x[0-9a-fA-F]+)?\s*$')
+INPUT = re.compile(r'^ (\.\S+)(?:\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*))?$')
+ADDRESS = re.compile(r'^\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*)$')
+
+
+def read_map(path, symbols):
+    """returns {object file or symbol: bytes of flash}"""
+    sizes = collections.Counter()
+    lines = iter(open(path, errors='replace').read().splitlines())
+    for line in lines:
+        if line.startswith('Linker script and memory map'):
+            break  # skip the discarded input sections before it
+    output = None
+    pending = None  # an input section name on a line of its own
+    for line in lines:
+        m = OUTPUT.match(line)
+        if m:
+            output = m.group(1)
+            pending = None
+            continue
+        m = INPUT.match(line)
+        if m:
+            pending = None
+            if m.group(2) is None:
+                pending = m.group(1)
+                continue
+            section, address, size, obj = m.groups()
+        else:
+            m = ADDRESS.match(line)
+            if not m or pending is None:
+                continue
+            section, (address, size, obj) = pending, m.groups()
+            pending = None
+        if (output is None or NOT_FLASH.search(output) or
+                int(address, 16) == 0 or int(size, 16) == 0):
+            continue
+        if symbols:
+            # .rodata.foo, .data.rel.ro.local._Z3foo -> foo, _Z3foo. With
+            # -fdata-sections and -ffunction-sections every symbol has its own.
+            key = section.rsplit('.', 1)[-1]
+            if key.isdigit() or not key:
+                key = section  # like .rodata.str1.1
+        else:
+            key = os.path.basename(obj.strip())
+        sizes[key] += int(size, 16)
+    return sizes
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('map', help='linker map, usually output.map')
+    parser.add_argument('--baseline', metavar='MAP', help='earlier map to compare with')
+    parser.add_argument('--filter', metavar='REGEX',
+                        help='only object files (or symbols) matching this')
+    parser.add_argument('--symbols', action='store_true',
+                        help='by symbol instead of by object file')
+    parser.add_argument('--top', type=int, default=30, metavar='N',
+                        help='show the N largest (default 30, 0 for all)')
+    args = parser.parse_args()
+    sizes = read_map(args.map, args.symbols)
+    base = read_map(args.baseline, args.symbols) if args.baseline else None
+    keys = set(sizes) | set(base or ())
+    if args.filter:
+        keys = {k for k in keys if re.search(args.filter, k)}
+    keys = sorted(keys, key=lambda k: (-sizes.get(k, 0), k))
+    shown = keys[:args.top] if args.top else keys
+    width = max([len(k) for k in shown] + [5])
+    print('%-*s %9s%s' % (width, 'flash', 'bytes', '     delta' if base else ''))
+    for k in shown:
+        delta = ' %+9d' % (sizes.get(k, 0) - base.get(k, 0)) if base else ''
+        print('%-*s %9d%s' % (width, k, sizes.get(k, 0), delta))
+    total = sum(sizes.get(k, 0) for k in keys)
+    delta = ' %+9d' % (total - sum(base.get(k, 0) for k in keys)) if base else ''
+    print('%-*s %9d%s' % (width, 'total', total, delta))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
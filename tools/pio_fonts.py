@@ -0,0 +1,28 @@
+"""PlatformIO extra script (see platformio.ini). Fails the build if a font in
+src/Screens is out of date with its character set in tools/fontsubset.py, so
+a glyph that got dropped can't silently go missing from a screen, or if a
+word pre-rendered by tools/timewords.py no longer matches the fonts pixel for
+pixel, or if an icon no longer decodes to its original in tools/icons_v1.cpp,
+and reports the fonts' share of flash from output.map after linking."""
+
+import os
+import subprocess
+import sys
+
+Import('env')
+
+TOOLS = os.path.join(env.subst('$PROJECT_DIR'), 'tools')
+
+for tool in ('fontsubset.py', 'timewords.py', 'rle2.py'):
+    if subprocess.call([sys.executable, os.path.join(TOOLS, tool),
+                        '--check']) != 0:
+        sys.exit(1)
+
+
+def report(source, target, env):
+    subprocess.call([sys.executable, os.path.join(TOOLS, 'mapsize.py'),
+                     '--symbols', '--filter', 'Optima|DSEG',
+                     os.path.join(env.subst('$PROJECT_DIR'), 'output.map')])
+
+
+env.AddPostAction('$BUILD_DIR/${PROGNAME}.elf', report)
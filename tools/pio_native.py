@@ -0,0 +1,16 @@
+"""PlatformIO extra script for [env:native] (see platformio.ini). Only the
+drawing code of the Adafruit GFX Library is built natively: its display
+drivers need SPI and I2C, which there aren't any of."""
+
+Import('env')
+
+SKIPPED = ('Adafruit_GrayOLED.cpp', 'Adafruit_SPITFT.cpp')
+
+
+def skip_drivers(node):
+    if node.name in SKIPPED:
+        return None
+    return node
+
+
+env.AddBuildMiddleware(skip_drivers, '*Adafruit*')
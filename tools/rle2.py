@@ -0,0 +1,292 @@
+#!/usr/bin/env python3
+"""Convert images to the version 2 rle format (see src/Screens/rle.h).
+
+Reads version 1 rle images out of a C++ source file (like
+tools/icons_v1.cpp) or PBM images, and writes C++ definitions of rle2
+images to stdout.
+
+  tools/rle2.py tools/icons_v1.cpp > icons2.cpp
+  tools/rle2.py --index 8 icon.pbm
+
+Every image is decoded again after it is encoded and compared with the
+original, so a bad conversion fails loudly instead of drawing garbage.
+
+With --check, converts nothing, and instead decodes every rle2 image in
+src/Screens/icons.cpp and compares it with its version 1 original in
+tools/icons_v1.cpp, failing if any differ or are missing.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+RLE2_DELTA = 0x01
+RLE2_INDEX_OPAQUE = 0x8000
+RLE2_INDEX_OFFSET = 0x7FFF
+DISPLAY_WIDTH = 200  # delta images can't be any wider (see rle.h)
+
+TOOLS = os.path.dirname(os.path.abspath(__file__))
+V1_ICONS = os.path.join(TOOLS, 'icons_v1.cpp')
+V2_ICONS = os.path.normpath(os.path.join(TOOLS, '..', 'src', 'Screens',
+                                         'icons.cpp'))
+
+
+def decode_v1(w, h, runs):
+    """version 1 runs -> list of rows of 0/1 pixels"""
+    pixels = []
+    opaque = 0
+    for run in runs:
+        pixels += [opaque] * run
+        opaque ^= 1
+    pixels = pixels[:w * h]
+    if len(pixels) != w * h:
+        raise ValueError('not enough runs for a %dx%d image' % (w, h))
+    return [pixels[y * w:(y + 1) * w] for y in range(h)]
+
+
+def read_v1_source(path):
+    """yields (name, rows) for every rle image defined in a C++ source file"""
+    src = open(path).read()
+    arrays = {
+        m.group(1): [int(v) for v in re.findall(r'\d+', m.group(2))]
+        for m in re.finditer(r'uint8_t\s+(\w+)\s*\[\]\s*=\s*\{(.*?)\};', src,
+                             re.S)
+    }
+    for m in re.finditer(
+            r'\brle\s+(\w+)\s*=\s*\{\s*(\d+)\s*,\s*(\d+)\s*,\s*(\w+)\s*\}',
+            src):
+        name, w, h, bitmap = m.group(1), int(m.group(2)), int(m.group(3)), m.group(4)
+        yield name, decode_v1(w, h, arrays[bitmap])
+
+
+def read_v2_source(path):
+    """returns {name: (w, h, flags, step, index, runs)} for every rle2 image
+    defined in a C++ source file"""
+    src = open(path).read()
+    arrays = {
+        m.group(1): [int(v, 0) for v in re.findall(r'0x[0-9a-fA-F]+|\d+',
+                                                    m.group(2))]
+        for m in re.finditer(r'uint(?:8|16)_t\s+(\w+)\s*\[\]\s*=\s*\{(.*?)\};',
+                             src, re.S)
+    }
+    images = {}
+    for m in re.finditer(
+            r'\brle2\s+(\w+)\s*=\s*\{\s*(\d+)\s*,\s*(\d+)\s*,\s*(\w+)\s*,'
+            r'\s*(\d+)\s*,\s*(\w+)\s*,\s*(\w+)\s*\}', src):
+        name, w, h, flags, step, index, runs = m.groups()
+        images[name] = (int(w), int(h),
+                        RLE2_DELTA if flags == 'RLE2_DELTA' else int(flags, 0),
+                        int(step), arrays.get(index), arrays[runs])
+    return images
+
+
+def read_pbm(path):
+    """yields (name, rows) for a plain (P1) or raw (P4) PBM file"""
+    data = open(path, 'rb').read()
+    tokens = []
+    pos = 0
+    while len(tokens) < 3:
+        m = re.compile(rb'\s*(#[^\n]*\n\s*)*(\S+)').match(data, pos)
+        tokens.append(m.group(2))
+        pos = m.end()
+    magic, w, h = tokens[0], int(tokens[1]), int(tokens[2])
+    if magic == b'P1':
+        bits = [int(b) for b in re.findall(rb'[01]', data[pos:])]
+        rows = [bits[y * w:(y + 1) * w] for y in range(h)]
+    elif magic == b'P4':
+        raster = data[pos + 1:]
+        stride = (w + 7) // 8
+        rows = [[(raster[y * stride + x // 8] >> (7 - x % 8)) & 1
+                 for x in range(w)] for y in range(h)]
+    else:
+        raise ValueError('%s: not a PBM file' % path)
+    name = 'rle_' + re.sub(r'\W', '_', os.path.splitext(os.path.basename(path))[0])
+    yield name, rows
+
+
+def varint(n):
+    out = []
+    while True:
+        b = n & 0x7F
+        n >>= 7
+        if n == 0:
+            out.append(b)
+            return out
+        out.append(b | 0x80)
+
+
+def encode(rows, delta, step):
+    """returns (runs, index) for the given rows"""
+    w = len(rows[0])
+    runs = []
+    index = []
+    opaque = 0  # kind of the current run
+    count = 0  # length of the current run
+    for y, row in enumerate(rows):
+        keyframe = step and y % step == 0
+        if delta and y > 0 and not keyframe:
+            row = [a ^ b for a, b in zip(row, rows[y - 1])]
+        for x, p in enumerate(row):
+            if keyframe and x == 0:
+                # runs don't cross indexed rows. End the current run here,
+                # with an empty run in between if the row starts with the
+                # same kind of run, so the runs still alternate.
+                if count > 0:
+                    runs += varint(count)
+                    opaque ^= 1
+                    count = 0
+                if p != opaque:
+                    runs += varint(0)
+                    opaque ^= 1
+                index.append(len(runs) | (RLE2_INDEX_OPAQUE if opaque else 0))
+            if p == opaque:
+                count += 1
+            else:
+                runs += varint(count)
+                opaque = p
+                count = 1
+    runs += varint(count)
+    if len(runs) > RLE2_INDEX_OFFSET and step:
+        raise ValueError('image too large to index')
+    return runs, index
+
+
+def decode(w, h, flags, step, index, runs, top=0):
+    """mirror of drawRLEBitmap(rle2) in src/Screens/rle.cpp. Returns the rows
+    from top down, starting from the nearest index entry."""
+    pos = 0
+    opaque = 0
+    y = 0
+    if index:
+        entry = index[top // step]
+        pos = entry & RLE2_INDEX_OFFSET
+        opaque = 1 if entry & RLE2_INDEX_OPAQUE else 0
+        y = top // step * step
+    bits = [0] * w
+    row = []
+    out = []
+    while y < h:
+        n = 0
+        shift = 0
+        while True:
+            b = runs[pos]
+            pos += 1
+            n |= (b & 0x7F) << shift
+            shift += 7
+            if not b & 0x80:
+                break
+        while n > 0 and y < h:
+            span = min(n, w - len(row))
+            row += [opaque] * span
+            n -= span
+            if len(row) == w:
+                if flags & RLE2_DELTA:
+                    bits = [a ^ b for a, b in zip(bits, row)]
+                    row = bits
+                if y >= top:
+                    out.append(row)
+                row = []
+                y += 1
+                if flags & RLE2_DELTA and index and y % step == 0:
+                    bits = [0] * w
+        opaque ^= 1
+    return out
+
+
+def convert(name, rows, step, force):
+    """encode both ways (unless forced), check, and pick the smaller"""
+    w, h = len(rows[0]), len(rows)
+    if force == RLE2_DELTA and w > DISPLAY_WIDTH:
+        raise ValueError('%s: %d wide, too wide for delta rows' % (name, w))
+    best = None
+    for flags in ((force,) if force is not None else (0, RLE2_DELTA)):
+        if flags & RLE2_DELTA and w > DISPLAY_WIDTH:
+            continue
+        runs, index = encode(rows, flags & RLE2_DELTA, step)
+        for top in range(0, h, step or h):
+            if decode(w, h, flags, step, index, runs, top) != rows[top:]:
+                raise AssertionError('%s: round trip failed' % name)
+        if best is None or len(runs) + 2 * len(index) < len(best[1]) + 2 * len(best[2]):
+            best = (flags, runs, index)
+    return best
+
+
+def check():
+    """round trips the generated icons against their version 1 originals"""
+    originals = dict(read_v1_source(V1_ICONS))
+    generated = read_v2_source(V2_ICONS)
+    ok = True
+    for name in sorted(set(originals) | set(generated)):
+        if name not in generated or name not in originals:
+            sys.stderr.write('%s: only in %s\n' % (
+                name, V1_ICONS if name in originals else V2_ICONS))
+            ok = False
+            continue
+        rows = originals[name]
+        w, h, flags, step, index, runs = generated[name]
+        if (w, h) != (len(rows[0]), len(rows)):
+            sys.stderr.write('%s: %dx%d, but the original is %dx%d\n' %
+                             (name, w, h, len(rows[0]), len(rows)))
+            ok = False
+            continue
+        for top in range(0, h, step if index else h):
+            if decode(w, h, flags, step, index, runs, top) != rows[top:]:
+                sys.stderr.write('%s: doesn\'t decode to the original from '
+                                 'row %d, regenerate %s\n' % (name, top, V2_ICONS))
+                ok = False
+                break
+    return 0 if ok else 1
+
+
+def emit(name, rows, flags, runs, index, step):
+    w, h = len(rows[0]), len(rows)
+    base = name[4:] if name.startswith('rle_') else name
+    print('// %dx%d, %d bytes%s' % (w, h, len(runs) + 2 * len(index),
+                                     ', delta rows' if flags else ''))
+    print('const uint8_t runs_%s[] = {' % base)
+    for i in range(0, len(runs), 16):
+        print('    ' + ' '.join('%d,' % b for b in runs[i:i + 16]))
+    print('};')
+    index_name = 'nullptr'
+    if index:
+        index_name = 'index_' + base
+        print('const uint16_t %s[] = {' % index_name)
+        for i in range(0, len(index), 8):
+            print('    ' + ' '.join('0x%04x,' % e for e in index[i:i + 8]))
+        print('};')
+    print('const rle2 %s = {%d, %d, %s, %d, %s, runs_%s};' %
+          (name, w, h, 'RLE2_DELTA' if flags else '0', step if index else 0,
+           index_name, base))
+    print()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('inputs', nargs='*', help='.cpp/.h or .pbm files')
+    parser.add_argument('--index', type=int, default=0, metavar='ROWS',
+                        help='add an index entry every ROWS rows (max 255)')
+    parser.add_argument('--delta', choices=('auto', 'on', 'off'), default='auto',
+                        help='store rows XORed with the row above (default: '
+                        'whichever is smaller)')
+    parser.add_argument('--check', action='store_true',
+                        help='check src/Screens/icons.cpp against '
+                        'tools/icons_v1.cpp instead of converting')
+    args = parser.parse_args()
+    if args.check:
+        return check()
+    if not args.inputs:
+        parser.error('no inputs')
+    force = {'auto': None, 'on': RLE2_DELTA, 'off': 0}[args.delta]
+    if not 0 <= args.index <= 255:
+        parser.error('--index must be 0..255')
+    for path in args.inputs:
+        images = read_pbm(path) if path.endswith('.pbm') else read_v1_source(path)
+        for name, rows in images:
+            flags, runs, index = convert(name, rows, args.index, force)
+            emit(name, rows, flags, runs, index, args.index)
+
+
+if __name__ == '__main__':
+    sys.exit(main())
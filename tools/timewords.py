@@ -0,0 +1,224 @@
+#!/usr/bin/env python3
+"""Pre-render the words TimeScreen draws into rle2 images.
+
+TimeScreen only ever draws a fixed set of words, so rather than rasterizing
+them from the font on every wake they are rendered once here, right justified
+exactly the way print() would have put them, and drawn with drawRLEBitmap.
+
+  tools/timewords.py > src/Screens/TimeWords.cpp
+  tools/timewords.py --check  # fail if it is out of date (run by the build)
+
+Every word is rendered the way Adafruit_GFX::drawChar renders it, positioned
+with the same bounds Adafruit_GFX::getTextBounds computes, and every image is
+decoded again after it is encoded and compared with the rendering. --check
+decodes every word in TimeWords.cpp the same way and compares it pixel for
+pixel with the word rendered from the fonts.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+import rle2
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+# the whole fonts, the ones in src/Screens are subsets (see fontsubset.py)
+FONTS = os.path.join(ROOT, 'tools', 'fonts')
+TIMEWORDS = os.path.join(ROOT, 'src', 'Screens', 'TimeWords.cpp')
+DISPLAY_WIDTH = 200
+
+# must match TimeScreen.cpp
+SMALL_NUMBERS = ['', 'one', 'two', 'three', 'four', 'five', 'six', 'seven',
+                 'eight', 'nine', 'ten', 'eleven', 'twelve', 'thirteen',
+                 'fourteen', 'fifteen', 'sixteen', 'seventeen', 'eighteen',
+                 'nineteen']
+DECADES = ['oh', None, 'twenty', 'thirty', 'forty', 'fifty']
+HOUR_FONT = 'OptimaLTStd_Black32pt7b'
+MINUTE_FONT = 'OptimaLTStd22pt7b'
+# the tables in TimeWords.h, and the words in them
+TABLES = [
+    ('hourWords', HOUR_FONT, SMALL_NUMBERS[:13]),
+    ('minuteWords', MINUTE_FONT, SMALL_NUMBERS),
+    ('decadeWords', MINUTE_FONT, DECADES),
+    ('onTheHourWords', MINUTE_FONT, ["o'clock", 'noon', 'midnight']),
+]
+
+
+class Font:
+    """a GFXfont read out of the generated font source (and header)"""
+
+    def __init__(self, name):
+        src = ''
+        for ext in ('.cpp', '.h'):
+            path = os.path.join(FONTS, name + ext)
+            if os.path.exists(path):
+                src += open(path).read()
+        src = re.sub(r'//[^\n]*', '', src)
+        m = re.search(r'%sBitmaps\[\][^{]*\{(.*?)\}' % name, src, re.S)
+        self.bitmap = [int(v, 16) for v in re.findall(r'0x[0-9A-Fa-f]+', m.group(1))]
+        m = re.search(r'%sGlyphs\[\][^{]*\{(.*?)\};' % name, src, re.S)
+        self.glyphs = [tuple(int(v) for v in g.split(','))
+                       for g in re.findall(r'\{([^{}]*)\}', m.group(1))]
+        m = re.search(r'\(GFXglyph \*\)%sGlyphs,\s*(\w+),\s*(\w+),\s*(\w+)' % name,
+                      src)
+        self.first, self.last, self.y_advance = (int(v, 0) for v in m.groups())
+
+    def glyph(self, c):
+        c = ord(c)
+        if c < self.first or c > self.last:
+            return None
+        return self.glyphs[c - self.first]
+
+    def bounds(self, text):
+        """Adafruit_GFX::getTextBounds(text, 0, 0, ...) as x1, y1, w, h"""
+        minx, miny, maxx, maxy = 0x7FFF, 0x7FFF, -1, -1
+        x = 0
+        for c in text:
+            g = self.glyph(c)
+            if g is None:
+                continue
+            _, w, h, xa, xo, yo = g
+            minx, miny = min(minx, x + xo), min(miny, yo)
+            maxx, maxy = max(maxx, x + xo + w - 1), max(maxy, yo + h - 1)
+            x += xa
+        if maxx < minx or maxy < miny:
+            return 0, 0, 0, 0
+        return minx, miny, maxx - minx + 1, maxy - miny + 1
+
+    def render(self, text, cursor_x):
+        """set of (x, y) pixels drawn by print(text), y relative to baseline"""
+        pixels = set()
+        x = cursor_x
+        for c in text:
+            g = self.glyph(c)
+            if g is None:
+                continue
+            offset, w, h, xa, xo, yo = g
+            for i in range(w * h):
+                bit = self.bitmap[offset + i // 8] >> (7 - i % 8) & 1
+                if bit:
+                    pixels.add((x + xo + i % w, yo + i // w))
+            x += xa
+        return pixels
+
+
+def word(font, text):
+    """image of text right justified like rightJustify() in TimeScreen.cpp.
+    Returns (x, top, rows) of the ink, or None if nothing is drawn."""
+    x1, _, w, _ = font.bounds(text)
+    pixels = font.render(text, DISPLAY_WIDTH - x1 - w)
+    if not pixels:
+        return None
+    left = min(x for x, _ in pixels)
+    top = min(y for _, y in pixels)
+    right = max(x for x, _ in pixels)
+    bottom = max(y for _, y in pixels)
+    rows = [[1 if (x, y) in pixels else 0 for x in range(left, right + 1)]
+            for y in range(top, bottom + 1)]
+    return left, top, rows
+
+
+def emit_table(name, font, texts, total):
+    entries = []
+    for text in texts:
+        image = word(font, text) if text else None
+        if image is None:
+            entries.append('    {0, 0, nullptr},%s' %
+                           ('  // "%s"' % text if text is not None else ''))
+            continue
+        x, top, rows = image
+        ident = 'rle_%s_%s' % (name, re.sub(r'\W', '_', text))
+        flags, runs, index = rle2.convert(ident, rows, 0, None)
+        rle2.emit(ident, rows, flags, runs, index, 0)
+        total[0] += len(runs)
+        entries.append('    {%d, %d, &%s},  // "%s"' % (x, top, ident, text))
+    return 'const TimeWord %s[] = {\n%s\n};\n' % (name, '\n'.join(entries))
+
+
+def read_words(path):
+    """the words in a generated TimeWords.cpp, decoded, as
+    {table: [(x, top, rows) or None]}, and its {line height name: value}"""
+    src = open(path).read()
+    arrays = {}
+    for name, body in re.findall(r'const uint(?:8|16)_t (\w+)\[\] = \{(.*?)\};',
+                                 src, re.S):
+        arrays[name] = [int(v, 0) for v in re.findall(r'0x[0-9a-f]+|\d+', body)]
+    images = {}
+    for m in re.finditer(r'const rle2 (\w+) = \{(\d+), (\d+), (\w+), (\d+), '
+                         r'(\w+), (\w+)\};', src):
+        name, w, h, flags, step, index, runs = m.groups()
+        flags = rle2.RLE2_DELTA if flags == 'RLE2_DELTA' else int(flags, 0)
+        images[name] = rle2.decode(int(w), int(h), flags, int(step),
+                                   arrays.get(index), arrays[runs])
+    tables = {}
+    for name, body in re.findall(r'const TimeWord (\w+)\[\] = \{(.*?)\n\};',
+                                 src, re.S):
+        tables[name] = [(int(x), int(top), images[image]) if image else None
+                        for x, top, image in
+                        re.findall(r'\{(-?\d+), (-?\d+), (?:&(\w+)|nullptr)\}', body)]
+    heights = {name: int(v) for name, v in
+               re.findall(r'const uint8_t (\w+) = (\d+);', src)}
+    return tables, heights
+
+
+def ink(image):
+    """set of (x, y) pixels an image from word() draws, y relative to baseline"""
+    if image is None:
+        return set()
+    left, top, rows = image
+    return {(left + x, top + y) for y, row in enumerate(rows)
+            for x, bit in enumerate(row) if bit}
+
+
+def check(fonts):
+    """compares every word in TimeWords.cpp with the word rendered from the
+    fonts, pixel for pixel"""
+    tables, heights = read_words(TIMEWORDS)
+    stale = []
+    for name, font, texts in TABLES:
+        images = tables.get(name, [])
+        if len(images) != len(texts):
+            stale.append('%s has %d words, not %d' % (name, len(images), len(texts)))
+            continue
+        for text, image in zip(texts, images):
+            rendered = word(fonts[font], text) if text else None
+            if image != rendered:
+                stale.append('%s "%s" (%d pixels differ)' %
+                             (name, text, len(ink(image) ^ ink(rendered))))
+    for name, font in (('hourYAdvance', HOUR_FONT), ('minuteYAdvance', MINUTE_FONT)):
+        if heights.get(name) != fonts[font].y_advance:
+            stale.append(name)
+    if stale:
+        path = os.path.relpath(TIMEWORDS, ROOT)
+        sys.stderr.write('out of date, run tools/timewords.py > %s: %s\n' %
+                         (path, ', '.join(stale)))
+        return 1
+    return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--check', action='store_true',
+                        help="don't write anything, fail if TimeWords.cpp is out of date")
+    args = parser.parse_args()
+    fonts = {HOUR_FONT: Font(HOUR_FONT), MINUTE_FONT: Font(MINUTE_FONT)}
+    if args.check:
+        return check(fonts)
+    print('// generated by tools/timewords.py from %s and %s, do not edit' %
+          (HOUR_FONT, MINUTE_FONT))
+    print()
+    print('#include "TimeWords.h"')
+    print()
+    total = [0]
+    tables = [emit_table(name, fonts[font], texts, total)
+              for name, font, texts in TABLES]
+    print('\n'.join(tables))
+    print('const uint8_t hourYAdvance = %d;' % fonts[HOUR_FONT].y_advance)
+    print('const uint8_t minuteYAdvance = %d;' % fonts[MINUTE_FONT].y_advance)
+    sys.stderr.write('%d bytes of runs\n' % total[0])
+
+
+if __name__ == '__main__':
+    sys.exit(main())